@@ -49,6 +49,12 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/PeleLMeX_PatchFlowVariables.H
        ${SRC_DIR}/PeleLMeX_PatchFlowVariables.cpp
        ${SRC_DIR}/PeleLMeX_Init.cpp
+       ${SRC_DIR}/PeleLMeX_MFPool.H
+       ${SRC_DIR}/PeleLMeX_MFPool.cpp
+       ${SRC_DIR}/PeleLMeX_CostMeasure.H
+       ${SRC_DIR}/PeleLMeX_CostMeasure.cpp
+       ${SRC_DIR}/PeleLMeX_RegridReport.H
+       ${SRC_DIR}/PeleLMeX_RegridReport.cpp
        ${SRC_DIR}/PeleLMeX_Plot.cpp
        ${SRC_DIR}/PeleLMeX_Projection.cpp
        ${SRC_DIR}/PeleLMeX_Reactions.cpp
@@ -58,8 +64,12 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/PeleLMeX_BPatch.H
        ${SRC_DIR}/PeleLMeX_BPatch.cpp
        ${SRC_DIR}/PeleLMeX_Temporals.cpp
+       ${SRC_DIR}/PeleLMeX_ThermoSoA.H
+       ${SRC_DIR}/PeleLMeX_ThermoSoA.cpp
        ${SRC_DIR}/PeleLMeX_Timestep.cpp
        ${SRC_DIR}/PeleLMeX_TransportProp.cpp
+       ${SRC_DIR}/PeleLMeX_TransportTable.H
+       ${SRC_DIR}/PeleLMeX_TransportTable.cpp
        ${SRC_DIR}/PeleLMeX_UMac.cpp
        ${SRC_DIR}/PeleLMeX_UserKeys.H
        ${SRC_DIR}/PeleLMeX_Utils.H
@@ -69,6 +79,10 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/main.cpp
   )
 
+  if(PELE_ENABLE_FLOAT_AUX)
+    target_compile_definitions(${pele_exe_name} PRIVATE PELE_USE_FLOAT_AUX)
+  endif()
+
   if(PELE_PHYSICS_ENABLE_SOOT)
     target_sources(${pele_exe_name}
       PRIVATE
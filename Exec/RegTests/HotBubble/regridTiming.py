@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+# A script to time PeleLMeX regrids with and without incremental_regrid
+# on the rising bubble, where the refined grids follow the bubble
+
+# Usage:
+#   ./regridTiming.py --input_file input.2d-regt --max_step 100 --np 4
+
+# Input:
+#   * input_file: the PeleLMeX input file
+#   * max_step: number of time steps of each run
+#   * regrid_int: regrid interval
+#   * np: number of MPI ranks
+
+# Head's up :
+#   * The PeleLMeX executable is searched for in the current directory.
+#   * Each run appends one CSV line per level and per regrid to
+#     regrid_default.csv and regrid_incremental.csv (see
+#     peleLM.regrid_report_file), previous reports are removed.
+
+import os
+import csv
+import argparse
+
+USAGE = """
+    Time the regrids of PeleLMeX with and without incremental_regrid.
+"""
+
+def regridTiming(args):
+    # Get the PeleLMeX exec
+    run_dir = os.getcwd()
+    executable = None
+    for f in os.listdir(run_dir):
+        if ( f.startswith("PeleLMeX") and f.endswith(".ex")):
+            executable = f
+    if executable is None:
+        raise RuntimeError("No PeleLMeX executable found in {}".format(run_dir))
+
+    reports = {}
+    for mode, incremental in [("default", 0), ("incremental", 1)]:
+        report = "regrid_{}.csv".format(mode)
+        if os.path.exists(report):
+            os.remove(report)
+        runtime_params = "amr.max_step={} ".format(args.max_step)
+        runtime_params += "amr.regrid_int={} ".format(args.regrid_int)
+        runtime_params += "amr.plot_int=-1 amr.check_int=-1 "
+        runtime_params += "peleLM.v=2 "
+        runtime_params += "peleLM.incremental_regrid={} ".format(incremental)
+        runtime_params += "peleLM.regrid_report_file={} ".format(report)
+        print(" Running with incremental_regrid = {}".format(incremental))
+        os.system("mpiexec -n {} ./{} {} {} > {}.log".format(args.np, executable, args.input_file, runtime_params, report[:-4]))
+        reports[mode] = readReport(report)
+
+    # Phase times are those of the whole regrid, repeated on each level line
+    print(" {:>12s} {:>8s} {:>14s} {:>14s} {:>12s}".format("mode", "regrids", "tRemakeLevel", "tTotal", "movedCells"))
+    for mode, events in reports.items():
+        nregrid = len(events)
+        remake = sum(e["tRemakeLevel"] for e in events.values())
+        total = sum(e["tTotal"] for e in events.values())
+        moved = sum(e["movedCells"] for e in events.values())
+        print(" {:>12s} {:>8d} {:>14.6e} {:>14.6e} {:>12d}".format(mode, nregrid, remake, total, moved))
+    for key in ["tRemakeLevel", "tTotal"]:
+        ref = sum(e[key] for e in reports["default"].values())
+        inc = sum(e[key] for e in reports["incremental"].values())
+        if inc > 0.0:
+            print(" {} speedup: {:.3f}".format(key, ref / inc))
+
+def readReport(report):
+    events = {}
+    with open(report) as f:
+        for row in csv.DictReader(f):
+            it = int(row["iter"])
+            if it not in events:
+                events[it] = {"tRemakeLevel": float(row["tRemakeLevel"]),
+                              "tTotal": float(row["tTotal"]),
+                              "movedCells": 0}
+            events[it]["movedCells"] += int(row["movedCells"])
+    return events
+
+def parse_args(arg_string=None):
+    parser = argparse.ArgumentParser(description=USAGE)
+
+    parser.add_argument("--input_file", type=str, default="input.2d-regt",
+                        help="input file name")
+
+    parser.add_argument("--max_step", type=int, default=100,
+                        help="number of time steps")
+
+    parser.add_argument("--regrid_int", type=int, default=2,
+                        help="regrid interval")
+
+    parser.add_argument("--np", type=int, default=4,
+                        help="number of MPI ranks")
+
+    if not arg_string is None:
+        args, unknown = parser.parse_known_args(arg_string)
+    else:
+        args, unknown = parser.parse_known_args()
+
+    return args
+
+if __name__ == "__main__":
+    args = parse_args()
+    regridTiming(args)
@@ -105,7 +105,8 @@ PeleLM::implicitNonLinearSolve(
     // WriteDebugPlotFile(GetVecOfConstPtrs(getNLBGChargeVect()),"NLBGCharge");
 
     // Newton initial guess
-    // TODO newton initial guess
+    setNewtonInitialGuess(sdcIter, a_dt);
+    storeNewtonGuessData(sdcIter, a_dt);
     nlSolveNorm(getNLstateVect(), nl_stateNorm);
 
     // Initial NL residual: update residual scaling and preconditioner
@@ -121,18 +122,18 @@ PeleLM::implicitNonLinearSolve(
     Real scaledResnE, scaledResphiV;
     getNLResidScaling(scaledResnE, scaledResphiV);
     Real max_nlres = std::max(scaledResnE, scaledResphiV);
+    int exit_newton = 0;
     if (max_nlres <= m_ef_newtonTol) {
       if (ef_verbose) {
-        amrex::Print() << " No Newton iteration needed, exiting. \n";
+        amrex::Print() << " No Newton iteration needed. \n";
       }
-      return;
+      exit_newton = 1;
     }
 
     // -----------------
     // Newton iteration
-    int exit_newton = 0;
     int NK_ite = 0;
-    do {
+    while (!exit_newton) {
       NK_ite += 1;
 
       // Verbose
@@ -177,7 +178,7 @@ PeleLM::implicitNonLinearSolve(
 
       // Exit condition
       exit_newton = testExitNewton(NK_ite, max_nlres, newtonDir_Norm);
-    } while (!exit_newton);
+    }
     NK_tot_count += NK_ite;
 
     // -----------------
@@ -200,23 +201,129 @@ PeleLM::implicitNonLinearSolve(
     int nGrowNL = 0;
     MultiFab::Copy(ldata_p->state, ldataNLs_p->nlState, 0, NE, 1, nGrowNL);
     MultiFab::Copy(ldata_p->state, ldataNLs_p->nlState, 1, PHIV, 1, nGrowNL);
+    // Keep the converged state around for the next SDC iteration guess
+    if (m_ef_newtonGuess != NewtonInitialGuess::OldState) {
+      MultiFab::Copy(ldataNLs_p->nlStateSDC, ldataNLs_p->nlState, 0, 0, 2, 0);
+    }
+  }
+  if (m_ef_newtonGuess != NewtonInitialGuess::OldState) {
+    m_ef_nlSDCValid = 1;
   }
 
+  // Newton iterations statistics for the current initial guess strategy
+  m_ef_guessNewtonCount += NK_tot_count;
+  m_ef_guessSolveCount += ef_substep;
+
   if (ef_verbose) {
     Real run_time = ParallelDescriptor::second() - strt_time;
     ParallelDescriptor::ReduceRealMax(
       run_time, ParallelDescriptor::IOProcessorNumber());
-    if (!m_ef_use_PETSC_direct) {
+    if (!m_ef_use_PETSC_direct && NK_tot_count > 0) {
       Real avgGMRES = (float)GMRES_tot_count / (float)NK_tot_count;
       amrex::Print() << "  [" << sdcIter << "] dt: " << a_dt
                      << " - Avg GMRES/Newton: " << avgGMRES << "\n";
     }
+    std::string guessName;
+    for (const auto& guess : newtonguess.str2int) {
+      if (guess.second == m_ef_newtonGuess && guess.first != "default") {
+        guessName = guess.first;
+      }
+    }
+    Real avgNewton = (float)m_ef_guessNewtonCount / (float)m_ef_guessSolveCount;
+    amrex::Print() << "  [" << sdcIter
+                   << "] Newton initial guess: " << guessName
+                   << " - Newton its: " << NK_tot_count
+                   << " - Avg Newton/solve: " << avgNewton << "\n";
     amrex::Print() << "  >> PeleLMeX::implicitNLSolve() " << run_time << "\n";
   }
 
   // VisMF::Write(advData->Forcing[0],"ForcingNE");
 }
 
+void
+PeleLM::setNewtonInitialGuess(int sdcIter, const Real& a_dt)
+{
+  // On entry, the scaled nlState holds t^{n} nE/phiV. Depending on the
+  // strategy, replace it by a better estimate of t^{n+1}:
+  // - Extrapolation: linear extrapolation from t^{n-1} and t^{n} on the first
+  //   SDC iteration, previous SDC converged state afterwards
+  // - PreviousSDC: previous SDC converged state for sdcIter > 1
+  if (m_ef_newtonGuess == NewtonInitialGuess::OldState) {
+    return;
+  }
+  const int useSDC = static_cast<int>(sdcIter > 1 && m_ef_nlSDCValid);
+  const int useExtrap = static_cast<int>(
+    m_ef_newtonGuess == NewtonInitialGuess::Extrapolation && sdcIter == 1 &&
+    m_ef_nlBackValid && m_ef_prevDt > 0.0);
+  if ((useSDC == 0) && (useExtrap == 0)) {
+    return;
+  }
+
+  // Build the scaled increment from t^{n} to the initial guess
+  Vector<MultiFab> guessIncr(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    guessIncr[lev].define(grids[lev], dmap[lev], 2, 0, MFInfo(), Factory(lev));
+
+    auto ldata_p = getLevelDataPtr(lev, AmrOldTime); // t^{n} data
+    auto ldataNLs_p = getLevelDataNLSolvePtr(lev);   // NL data
+    const MultiFab& guessSrc =
+      (useSDC != 0) ? ldataNLs_p->nlStateSDC : ldataNLs_p->nlStateBack;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(guessIncr[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& nE_o = ldata_p->state.const_array(mfi, NE);
+      auto const& phiV_o = ldata_p->state.const_array(mfi, PHIV);
+      auto const& src = guessSrc.const_array(mfi);
+      auto const& incr = guessIncr[lev].array(mfi);
+      Real ratio = a_dt / m_ef_prevDt;
+      Real nEScaleInv = 1.0 / nE_scale;
+      Real phiVScaleInv = 1.0 / phiV_scale;
+      amrex::ParallelFor(
+        bx, [nE_o, phiV_o, src, incr, ratio, nEScaleInv, phiVScaleInv,
+             useSDC] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          Real nE_g = 0.0;
+          Real phiV_g = 0.0;
+          if (useSDC != 0) {
+            nE_g = src(i, j, k, 0);
+            phiV_g = src(i, j, k, 1);
+          } else {
+            nE_g = nE_o(i, j, k) + ratio * (nE_o(i, j, k) - src(i, j, k, 0));
+            phiV_g =
+              phiV_o(i, j, k) + ratio * (phiV_o(i, j, k) - src(i, j, k, 1));
+          }
+          nE_g = amrex::max(nE_g, 0.0);
+          incr(i, j, k, 0) = (nE_g - nE_o(i, j, k)) * nEScaleInv;
+          incr(i, j, k, 1) = (phiV_g - phiV_o(i, j, k)) * phiVScaleInv;
+        });
+    }
+  }
+
+  // Use the state update machinery to averageDown and fillpatch the guess
+  updateNLState(GetVecOfPtrs(guessIncr));
+}
+
+void
+PeleLM::storeNewtonGuessData(int sdcIter, const Real& a_dt)
+{
+  // Stash t^{n} for the next step extrapolation, once per step
+  if (m_ef_newtonGuess != NewtonInitialGuess::Extrapolation || sdcIter != 1) {
+    return;
+  }
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto ldata_p = getLevelDataPtr(lev, AmrOldTime);
+    auto ldataNLs_p = getLevelDataNLSolvePtr(lev);
+    MultiFab::Copy(ldataNLs_p->nlStateBack, ldata_p->state, NE, 0, 1, 0);
+    MultiFab::Copy(ldataNLs_p->nlStateBack, ldata_p->state, PHIV, 1, 1, 0);
+  }
+  m_ef_prevDt = a_dt;
+  m_ef_nlBackValid = 1;
+  // SDC data from the previous step is outdated
+  m_ef_nlSDCValid = 0;
+}
+
 int
 PeleLM::testExitNewton(
   int newtonIter, const Real& max_res, const Real& norm_NewtonDir)
@@ -50,7 +50,8 @@ PeleLM::getLevelDataPtr(
   }
   m_leveldata_floating = std::make_unique<LevelData>(
     grids[lev], dmap[lev], *m_factory[lev], m_incompressible, m_has_divu,
-    m_nAux, m_nGrowState, m_use_soret, static_cast<int>(m_do_les));
+    m_nAux, m_nGrowState, m_use_soret, static_cast<int>(m_do_les),
+    static_cast<int>(m_lowMemTransport == 0));
   Real time = getTime(lev, a_time);
   fillpatch_state(lev, time, m_leveldata_floating->state, m_nGrowState);
   return m_leveldata_floating.get();
@@ -228,6 +229,7 @@ Vector<MultiFab*>
 PeleLM::getDiffusivityVect(const TimeStamp& a_time)
 {
   AMREX_ASSERT(!m_incompressible);
+  ensureDiffusivity(a_time);
   Vector<MultiFab*> r;
   r.reserve(finest_level + 1);
   if (a_time == AmrOldTime) {
@@ -359,6 +361,7 @@ PeleLM::averageDownReaction()
     average_down(
       ldataRFine_p->I_R, ldataRCrse_p->I_R, 0, nCompIR(), refRatio(lev - 1));
 #endif
+    ldataRCrse_p->heatReleaseCached = 0;
   }
 }
 
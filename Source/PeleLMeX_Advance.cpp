@@ -1,6 +1,7 @@
 #include <PeleLMeX.H>
 #include <PeleLMeX_Utils.H>
 #include <AMReX_MemProfiler.H>
+#include <limits>
 #include <memory>
 
 using namespace amrex;
@@ -17,6 +18,7 @@ PeleLM::Advance(int is_initIter)
 
   // Start timing current time step
   Real strt_time = ParallelDescriptor::second();
+  m_deltaTIterStep = 0;
 
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::setup", PLM_SETUP);
@@ -64,13 +66,15 @@ PeleLM::Advance(int is_initIter)
 
   //----------------------------------------------------------------
   // Data for the advance, only live for the duration of the advance
+  // (buffers are recycled through the MF pool if activated)
   std::unique_ptr<AdvanceDiffData> diffData;
   diffData = std::make_unique<AdvanceDiffData>(
-    finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar, m_use_soret);
+    finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar, m_use_soret,
+    0, &m_mfPool);
   std::unique_ptr<AdvanceAdvData> advData;
   advData = std::make_unique<AdvanceAdvData>(
     finest_level, grids, dmap, m_factory, m_incompressible, m_nGrowAdv,
-    m_nGrowMAC);
+    m_nGrowMAC, &m_mfPool);
 
   for (int lev = 0; lev <= finest_level; lev++) {
     m_extSource[lev]->setVal(0.);
@@ -186,8 +190,54 @@ PeleLM::Advance(int is_initIter)
   } else {
 
     // SDC iterations
+    // With adaptive SDC, stop once the new state change between two
+    // iterations is below m_sdcTol. Any iteration may then be the last one:
+    // the balances boundary fluxes integrals are rolled back to their
+    // pre-SDC values before each iteration.
+    Vector<MultiFab> sdcPrev;
+    const auto massFluxPreSDC = m_domainMassFlux;
+    const auto rhoHFluxPreSDC = m_domainRhoHFlux;
+    const auto rhoYFluxPreSDC = m_domainRhoYFlux;
+    if (m_sdcAdaptive != 0) {
+      sdcPrev.resize(finest_level + 1);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        sdcPrev[lev] = m_mfPool.acquire(
+          lev, grids[lev], dmap[lev], NUM_SPECIES + 2, 0, Factory(lev));
+      }
+    }
+    int sdcIterDone = 0;
+    Real sdcChange = 0.0;
     for (int sdc_iter = 1; sdc_iter <= m_nSDCmax; ++sdc_iter) {
+      if (m_sdcAdaptive != 0 && sdc_iter > 1) {
+        m_domainMassFlux = massFluxPreSDC;
+        m_domainRhoHFlux = rhoHFluxPreSDC;
+        m_domainRhoYFlux = rhoYFluxPreSDC;
+      }
       oneSDC(sdc_iter, advData, diffData);
+      sdcIterDone = sdc_iter;
+      if (m_sdcAdaptive != 0) {
+        sdcChange = sdcIterChange(sdc_iter, GetVecOfPtrs(sdcPrev));
+        if (sdc_iter >= m_sdcIterMin && sdcChange < m_sdcTol) {
+          break;
+        }
+      }
+    }
+    if (m_sdcAdaptive != 0) {
+      m_mfPool.release(sdcPrev);
+      if (is_initIter == 0) {
+        m_sdcIterTotal += sdcIterDone;
+        m_sdcStepCount += 1;
+      }
+      if (m_verbose > 0) {
+        amrex::Print() << " >> SDC iterations: " << sdcIterDone
+                       << " (change: " << sdcChange;
+        if (m_sdcStepCount > 0) {
+          amrex::Print() << ", average per step: "
+                         << static_cast<Real>(m_sdcIterTotal) /
+                              static_cast<Real>(m_sdcStepCount);
+        }
+        amrex::Print() << ")\n";
+      }
     }
 
     // Post SDC
@@ -255,12 +305,34 @@ PeleLM::Advance(int is_initIter)
 
   //----------------------------------------------------------------
   // Wrapup advance
+  m_costMeasure.addStep();
+
+  // DeltaT iterations count, summed over the SDC iterations
+  if (is_initIter == 0 && m_deltaTIterStep > 0) {
+    m_deltaTIterTotal += m_deltaTIterStep;
+    m_deltaTStepCount += 1;
+    if (m_verbose > 1) {
+      amrex::Print() << " >> DeltaT iterations: " << m_deltaTIterStep
+                     << " (average per step: "
+                     << static_cast<Real>(m_deltaTIterTotal) /
+                          static_cast<Real>(m_deltaTStepCount)
+                     << ")\n";
+    }
+  }
+
   // Timing current time step
-  if (m_verbose > 0) {
+  if (m_verbose > 0 || (m_autoMaxGridSize != 0)) {
     Real run_time = ParallelDescriptor::second() - strt_time;
     ParallelDescriptor::ReduceRealMax(
       run_time, ParallelDescriptor::IOProcessorNumber());
-    amrex::Print() << " >> PeleLMeX::Advance() --> Time: " << run_time << "\n";
+    if (is_initIter == 0) {
+      m_autoStepTime += run_time;
+      m_autoStepCount += 1;
+    }
+    if (m_verbose > 0) {
+      amrex::Print() << " >> PeleLMeX::Advance() --> Time: " << run_time
+                     << "\n";
+    }
   }
 }
 
@@ -444,3 +516,92 @@ PeleLM::oneSDC(
   floorSpecies(AmrNewTime);
   setThermoPress(AmrNewTime);
 }
+
+Real
+PeleLM::sdcIterChange(int a_sdcIter, const Vector<MultiFab*>& a_prev)
+{
+  BL_PROFILE("PeleLMeX::sdcIterChange()");
+
+  // Single pass over the new state: reduce the changes and the norms used
+  // to scale them, and store the new state for the next iteration
+  const bool checkDivu = (m_has_divu != 0) && (a_sdcIter > 2);
+  Array<Real, 5> r{{0.0}};
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+#ifdef AMREX_USE_EB
+    auto const& ebfact = EBFactory(lev);
+#endif
+    ReduceOps<ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMax, ReduceOpMax>
+      reduce_op;
+    ReduceData<Real, Real, Real, Real, Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+    for (MFIter mfi(*a_prev[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& rho = ldata_p->state.const_array(mfi, DENSITY);
+      auto const& rhoY = ldata_p->state.const_array(mfi, FIRSTSPEC);
+      auto const& rhoH = ldata_p->state.const_array(mfi, RHOH);
+      auto const& divu = (m_has_divu != 0) ? ldata_p->divu.const_array(mfi)
+                                           : Array4<const Real>{};
+      auto const& prev = a_prev[lev]->array(mfi);
+      // Fine-covered cells do not count
+      auto const& mask = (lev < finest_level)
+                           ? m_coveredMask[lev]->const_array(mfi)
+                           : Array4<const int>{};
+#ifdef AMREX_USE_EB
+      auto const& flag = ebfact.getMultiEBCellFlagFab().const_array(mfi);
+#endif
+      reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+          bool skip = mask && mask(i, j, k) == 0;
+#ifdef AMREX_USE_EB
+          skip = skip || flag(i, j, k).isCovered();
+#endif
+          Real dY = 0.0;
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            dY = amrex::max(dY, std::abs(rhoY(i, j, k, n) - prev(i, j, k, n)));
+            prev(i, j, k, n) = rhoY(i, j, k, n);
+          }
+          dY /= rho(i, j, k);
+          const Real dH = std::abs(rhoH(i, j, k) - prev(i, j, k, NUM_SPECIES));
+          const Real H = std::abs(rhoH(i, j, k));
+          prev(i, j, k, NUM_SPECIES) = rhoH(i, j, k);
+          Real dDivu = 0.0;
+          Real Divu = 0.0;
+          if (divu) {
+            dDivu = std::abs(divu(i, j, k) - prev(i, j, k, NUM_SPECIES + 1));
+            Divu = std::abs(divu(i, j, k));
+            prev(i, j, k, NUM_SPECIES + 1) = divu(i, j, k);
+          }
+          if (skip) {
+            return {0.0, 0.0, 0.0, 0.0, 0.0};
+          }
+          return {dY, dH, H, dDivu, Divu};
+        });
+    }
+    ReduceTuple hv = reduce_data.value(reduce_op);
+    r[0] = std::max(r[0], amrex::get<0>(hv));
+    r[1] = std::max(r[1], amrex::get<1>(hv));
+    r[2] = std::max(r[2], amrex::get<2>(hv));
+    r[3] = std::max(r[3], amrex::get<3>(hv));
+    r[4] = std::max(r[4], amrex::get<4>(hv));
+  }
+  ParallelDescriptor::ReduceRealMax(r.data(), static_cast<int>(r.size()));
+
+  if (a_sdcIter == 1) {
+    return std::numeric_limits<Real>::max();
+  }
+  const Real tiny = std::numeric_limits<Real>::min();
+  const Real dY = r[0];
+  const Real dH = r[1] / std::max(r[2], tiny);
+  const Real dDivu = checkDivu ? r[3] / std::max(r[4], tiny) : 0.0;
+  if (m_verbose > 1) {
+    amrex::Print() << "   SDC iter [" << a_sdcIter << "] change: Y " << dY
+                   << ", rhoH " << dH;
+    if (checkDivu) {
+      amrex::Print() << ", divU " << dDivu;
+    }
+    amrex::Print() << "\n";
+  }
+  return std::max(dY, std::max(dH, dDivu));
+}
@@ -295,6 +295,7 @@ PeleLM::getScalarAdvForce(
 void
 PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
 {
+  BL_PROFILE("PeleLMeX::computeScalarAdvTerms()");
 
   //----------------------------------------------------------------
   // Get the BCRecs and AdvectionTypes
@@ -316,10 +317,9 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
   Vector<Array<MultiFab, AMREX_SPACEDIM>> fluxes(finest_level + 1);
   for (int lev = 0; lev <= finest_level; ++lev) {
     for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
-      fluxes[lev][idim].define(
-        amrex::convert(grids[lev], IntVect::TheDimensionVector(idim)),
-        dmap[lev], NUM_SPECIES + 1, 0, MFInfo(),
-        Factory(lev)); // Species + RhoH
+      fluxes[lev][idim] = m_mfPool.acquire(
+        lev, amrex::convert(grids[lev], IntVect::TheDimensionVector(idim)),
+        dmap[lev], NUM_SPECIES + 1, 0, Factory(lev)); // Species + RhoH
     }
   }
 
@@ -330,15 +330,6 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
     // Get level data ptr Old
     auto* ldata_p = getLevelDataPtr(lev, AmrOldTime);
 
-    // Define edge state: Density + Species + RhoH + Temp
-    int nGrow = 0;
-    Array<MultiFab, AMREX_SPACEDIM> edgeState;
-    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
-      edgeState[idim].define(
-        amrex::convert(grids[lev], IntVect::TheDimensionVector(idim)),
-        dmap[lev], NUM_SPECIES + 3, nGrow, MFInfo(), Factory(lev));
-    }
-
 #ifdef PELE_USE_EFIELD
     //----------------------------------------------------------------
     // Assemble drift and mac velocities
@@ -355,6 +346,27 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
       MultiFab::Copy(divu, advData->mac_divu[lev], 0, 0, 1, m_nGrowdivu);
     }
 
+    //----------------------------------------------------------------
+    // Single tile sweep with tile-local edge states
+    if (m_fusedScalarAdv != 0) {
+      computeScalarAdvFluxesFused(
+        lev, GetArrOfConstPtrs(advData->umac[lev]), divu, advData->Forcing[lev],
+        GetArrOfPtrs(fluxes[lev]));
+#ifdef AMREX_USE_EB
+      EB_set_covered_faces(GetArrOfPtrs(fluxes[lev]), 0.);
+#endif
+      continue;
+    }
+
+    // Define edge state: Density + Species + RhoH + Temp
+    int nGrow = 0;
+    Array<MultiFab, AMREX_SPACEDIM> edgeState;
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      edgeState[idim] = m_mfPool.acquire(
+        lev, amrex::convert(grids[lev], IntVect::TheDimensionVector(idim)),
+        dmap[lev], NUM_SPECIES + 3, nGrow, Factory(lev));
+    }
+
     //----------------------------------------------------------------
 #ifdef AMREX_USE_EB
     // Get EBFact & areafrac
@@ -369,6 +381,7 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
 #endif
     for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
 
+      const Real t0 = m_costMeasure.start();
       Box const& bx = mfi.tilebox();
       AMREX_D_TERM(auto const& umac = advData->umac[lev][0].const_array(mfi);
                    , auto const& vmac = advData->umac[lev][1].const_array(mfi);
@@ -454,6 +467,7 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
         m_Godunov_ppm != 0, m_Godunov_ForceInTrans != 0, is_velocity,
         fluxes_are_area_weighted, m_advection_type, m_Godunov_ppm_limiter);
 #endif
+      m_costMeasure.stop(lev, mfi, t0, CostMeasure::Advection);
     }
 
     // Get edge density by summing over the species
@@ -632,6 +646,9 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
 #ifdef AMREX_USE_EB
     EB_set_covered_faces(GetArrOfPtrs(fluxes[lev]), 0.);
 #endif
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      m_mfPool.release(lev, std::move(edgeState[idim]));
+    }
   }
 
   //----------------------------------------------------------------
@@ -651,7 +668,7 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
   //----------------------------------------------------------------
   // If balances are required, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
-  if (m_sdcIter == m_nSDCmax) {
+  if (isLastSDCIter()) {
     if (m_do_massBalance != 0) {
       addMassFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0]);
     }
@@ -757,6 +774,178 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
       });
   }
   Gpu::streamSynchronize();
+  m_mfPool.release(fluxes);
+}
+
+void
+PeleLM::computeScalarAdvFluxesFused(
+  int lev,
+  const Array<const MultiFab*, AMREX_SPACEDIM>& a_umac,
+  const MultiFab& a_divu,
+  const MultiFab& a_forcing,
+  const Array<MultiFab*, AMREX_SPACEDIM>& a_fluxes)
+{
+  BL_PROFILE("PeleLMeX::computeScalarAdvFluxesFused()");
+
+  // Species, Density, Temp and RhoH edge states and fluxes are computed
+  // within a single MFIter sweep. Edge states only live in tile-sized
+  // scratch FABs instead of level-wide face MultiFabs.
+  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
+  auto bcRecSpec_d = convertToDeviceVector(bcRecSpec);
+  auto AdvTypeSpec = fetchAdvTypeArray(FIRSTSPEC, NUM_SPECIES);
+  auto AdvTypeSpec_d = convertToDeviceVector(AdvTypeSpec);
+  auto bcRecTemp = fetchBCRecArray(TEMP, 1);
+  auto bcRecTemp_d = convertToDeviceVector(bcRecTemp);
+  auto AdvTypeTemp = fetchAdvTypeArray(TEMP, 1);
+  auto AdvTypeTemp_d = convertToDeviceVector(AdvTypeTemp);
+  auto bcRecRhoH = fetchBCRecArray(RHOH, 1);
+  auto bcRecRhoH_d = convertToDeviceVector(bcRecRhoH);
+  auto AdvTypeRhoH = fetchAdvTypeArray(RHOH, 1);
+  auto AdvTypeRhoH_d = convertToDeviceVector(AdvTypeRhoH);
+
+  auto* ldata_p = getLevelDataPtr(lev, AmrOldTime);
+
+#ifdef AMREX_USE_EB
+  const auto& ebfact = EBFactory(lev);
+  Array<const MultiCutFab*, AMREX_SPACEDIM> areafrac;
+  areafrac = ebfact.getAreaFrac();
+#endif
+
+  bool is_velocity = false;
+  bool fluxes_are_area_weighted = false;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  {
+    // Tile scratch: Density + Species + RhoH + Temp edge states
+    Array<FArrayBox, AMREX_SPACEDIM> edgeFab;
+    for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+
+      const Real t0 = m_costMeasure.start();
+      Box const& bx = mfi.tilebox();
+      for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+        edgeFab[idim].resize(
+          amrex::surroundingNodes(bx, idim), NUM_SPECIES + 3,
+          The_Async_Arena());
+      }
+
+      AMREX_D_TERM(auto const& umac = a_umac[0]->const_array(mfi);
+                   , auto const& vmac = a_umac[1]->const_array(mfi);
+                   , auto const& wmac = a_umac[2]->const_array(mfi);)
+      AMREX_D_TERM(auto const& fx = a_fluxes[0]->array(mfi, 0);
+                   , auto const& fy = a_fluxes[1]->array(mfi, 0);
+                   , auto const& fz = a_fluxes[2]->array(mfi, 0);)
+      AMREX_D_TERM(auto const& fxh = a_fluxes[0]->array(mfi, NUM_SPECIES);
+                   , auto const& fyh = a_fluxes[1]->array(mfi, NUM_SPECIES);
+                   , auto const& fzh = a_fluxes[2]->array(mfi, NUM_SPECIES);)
+      AMREX_D_TERM(auto const& edgex = edgeFab[0].array(1);
+                   , auto const& edgey = edgeFab[1].array(1);
+                   , auto const& edgez = edgeFab[2].array(1);)
+      AMREX_D_TERM(auto const& edgexT = edgeFab[0].array(NUM_SPECIES + 2);
+                   , auto const& edgeyT = edgeFab[1].array(NUM_SPECIES + 2);
+                   , auto const& edgezT = edgeFab[2].array(NUM_SPECIES + 2);)
+      AMREX_D_TERM(auto const& edgexH = edgeFab[0].array(NUM_SPECIES + 1);
+                   , auto const& edgeyH = edgeFab[1].array(NUM_SPECIES + 1);
+                   , auto const& edgezH = edgeFab[2].array(NUM_SPECIES + 1);)
+      auto const& divu_arr = a_divu.const_array(mfi);
+      auto const& rhoY_arr = ldata_p->state.const_array(mfi, FIRSTSPEC);
+      auto const& rhoh_arr = ldata_p->state.const_array(mfi, RHOH);
+      auto const& temp_arr = ldata_p->state.const_array(mfi, TEMP);
+      auto const& forceY_arr = a_forcing.const_array(mfi, 0);
+      auto const& forceT_arr = a_forcing.const_array(mfi, NUM_SPECIES);
+
+      // Species edge states and fluxes
+      bool knownEdgeState = false;
+      HydroUtils::ComputeFluxesOnBoxFromState(
+        bx, NUM_SPECIES, mfi, rhoY_arr, AMREX_D_DECL(fx, fy, fz),
+        AMREX_D_DECL(edgex, edgey, edgez), knownEdgeState,
+        AMREX_D_DECL(umac, vmac, wmac), divu_arr, forceY_arr, geom[lev], m_dt,
+        bcRecSpec, bcRecSpec_d.dataPtr(), AdvTypeSpec_d.dataPtr(),
+#ifdef AMREX_USE_EB
+        ebfact,
+#endif
+        m_Godunov_ppm != 0, m_Godunov_ForceInTrans != 0, is_velocity,
+        fluxes_are_area_weighted, m_advection_type, m_Godunov_ppm_limiter);
+
+      // Temperature edge state, fluxes are overwritten by RhoH below
+      HydroUtils::ComputeFluxesOnBoxFromState(
+        bx, 1, mfi, temp_arr, AMREX_D_DECL(fxh, fyh, fzh),
+        AMREX_D_DECL(edgexT, edgeyT, edgezT), knownEdgeState,
+        AMREX_D_DECL(umac, vmac, wmac), divu_arr, forceT_arr, geom[lev], m_dt,
+        bcRecTemp, bcRecTemp_d.dataPtr(), AdvTypeTemp_d.dataPtr(),
+#ifdef AMREX_USE_EB
+        ebfact,
+#endif
+        m_Godunov_ppm != 0, m_Godunov_ForceInTrans != 0, is_velocity,
+        fluxes_are_area_weighted, m_advection_type, m_Godunov_ppm_limiter);
+
+#ifdef AMREX_USE_EB
+      auto const& flagfab = ebfact.getMultiEBCellFlagFab()[mfi];
+#endif
+
+      // Density and RhoH edge states in a single face pass
+      for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+        const Box& ebx = amrex::surroundingNodes(bx, idim);
+        auto const& rho_ed = edgeFab[idim].array(0);
+        auto const& rhoY_ed = edgeFab[idim].const_array(1);
+        auto const& T_ed = edgeFab[idim].const_array(NUM_SPECIES + 2);
+        auto const& rhoH_ed = edgeFab[idim].array(NUM_SPECIES + 1);
+#ifdef AMREX_USE_EB
+        if (flagfab.getType(ebx) == FabType::covered) { // Covered boxes
+          amrex::ParallelFor(
+            ebx,
+            [rho_ed, rhoH_ed] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              rho_ed(i, j, k) = 0.0;
+              rhoH_ed(i, j, k) = 0.0;
+            });
+        } else if (flagfab.getType(ebx) != FabType::regular) { // EB containing
+                                                               // boxes
+          const auto& afrac = areafrac[idim]->array(mfi);
+          amrex::ParallelFor(
+            ebx, [rho_ed, rhoY_ed, T_ed, rhoH_ed,
+                  afrac] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              rho_ed(i, j, k) = 0.0;
+              if (afrac(i, j, k) <= 0.0) { // Covered faces
+                rhoH_ed(i, j, k) = 0.0;
+              } else {
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  rho_ed(i, j, k) += rhoY_ed(i, j, k, n);
+                }
+                getRHmixGivenTY(i, j, k, rho_ed, rhoY_ed, T_ed, rhoH_ed);
+              }
+            });
+        } else // Regular boxes
+#endif
+        {
+          amrex::ParallelFor(
+            ebx, [rho_ed, rhoY_ed, T_ed,
+                  rhoH_ed] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              rho_ed(i, j, k) = 0.0;
+              for (int n = 0; n < NUM_SPECIES; n++) {
+                rho_ed(i, j, k) += rhoY_ed(i, j, k, n);
+              }
+              getRHmixGivenTY(i, j, k, rho_ed, rhoY_ed, T_ed, rhoH_ed);
+            });
+        }
+      }
+
+      // RhoH fluxes from the known edge state
+      // Pass the Temp forces again here, but they aren't used.
+      knownEdgeState = true;
+      HydroUtils::ComputeFluxesOnBoxFromState(
+        bx, 1, mfi, rhoh_arr, AMREX_D_DECL(fxh, fyh, fzh),
+        AMREX_D_DECL(edgexH, edgeyH, edgezH), knownEdgeState,
+        AMREX_D_DECL(umac, vmac, wmac), divu_arr, forceT_arr, geom[lev], m_dt,
+        bcRecRhoH, bcRecRhoH_d.dataPtr(), AdvTypeRhoH_d.dataPtr(),
+#ifdef AMREX_USE_EB
+        ebfact,
+#endif
+        m_Godunov_ppm != 0, m_Godunov_ForceInTrans != 0, is_velocity,
+        fluxes_are_area_weighted, m_advection_type, m_Godunov_ppm_limiter);
+      m_costMeasure.stop(lev, mfi, t0, CostMeasure::Advection);
+    }
+  }
 }
 
 void
@@ -709,12 +709,13 @@ PeleLM::fillpatch_chemFunctCall(
   int lev, const amrex::Real a_time, amrex::MultiFab& a_fctC, int nGhost)
 {
   ProbParm const* lprobparm = prob_parm_d;
+  MultiFab fctC_fine = getRealFunctC(lev);
   if (lev == 0) {
     PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> bndry_func(
       geom[lev], {m_bcrec_force}, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
     FillPatchSingleLevel(
-      a_fctC, IntVect(nGhost), a_time, {&(m_leveldatareact[lev]->functC)},
-      {a_time}, 0, 0, 1, geom[lev], bndry_func, 0);
+      a_fctC, IntVect(nGhost), a_time, {&fctC_fine}, {a_time}, 0, 0, 1,
+      geom[lev], bndry_func, 0);
   } else {
 
     // Interpolator
@@ -725,14 +726,28 @@ PeleLM::fillpatch_chemFunctCall(
       PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
     PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(
       geom[lev], {m_bcrec_force}, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+    MultiFab fctC_crse = getRealFunctC(lev - 1);
     FillPatchTwoLevels(
-      a_fctC, IntVect(nGhost), a_time, {&(m_leveldatareact[lev - 1]->functC)},
-      {a_time}, {&(m_leveldatareact[lev]->functC)}, {a_time}, 0, 0, 1,
-      geom[lev - 1], geom[lev], crse_bndry_func, 0, fine_bndry_func, 0,
-      refRatio(lev - 1), mapper, {m_bcrec_force}, 0);
+      a_fctC, IntVect(nGhost), a_time, {&fctC_crse}, {a_time}, {&fctC_fine},
+      {a_time}, 0, 0, 1, geom[lev - 1], geom[lev], crse_bndry_func, 0,
+      fine_bndry_func, 0, refRatio(lev - 1), mapper, {m_bcrec_force}, 0);
   }
 }
 
+MultiFab
+PeleLM::getRealFunctC(int lev)
+{
+  auto& fctC = m_leveldatareact[lev]->functC;
+#ifdef PELE_USE_FLOAT_AUX
+  MultiFab fctC_real(
+    fctC.boxArray(), fctC.DistributionMap(), 1, fctC.nGrowVect());
+  amrex::Copy(fctC_real, fctC, 0, 0, 1, fctC.nGrowVect());
+  return fctC_real;
+#else
+  return MultiFab(fctC, amrex::make_alias, 0, 1);
+#endif
+}
+
 // Fill the state
 void
 PeleLM::fillcoarsepatch_state(
@@ -839,10 +854,11 @@ PeleLM::fillcoarsepatch_chemFunctCall(
     geom[lev - 1], {m_bcrec_force}, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
   PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(
     geom[lev], {m_bcrec_force}, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+  MultiFab fctC_crse = getRealFunctC(lev - 1);
   InterpFromCoarseLevel(
-    a_fctC, IntVect(nGhost), a_time, m_leveldatareact[lev - 1]->functC, 0, 0, 1,
-    geom[lev - 1], geom[lev], crse_bndry_func, 0, fine_bndry_func, 0,
-    refRatio(lev - 1), mapper, {m_bcrec_force}, 0);
+    a_fctC, IntVect(nGhost), a_time, fctC_crse, 0, 0, 1, geom[lev - 1],
+    geom[lev], crse_bndry_func, 0, fine_bndry_func, 0, refRatio(lev - 1),
+    mapper, {m_bcrec_force}, 0);
 }
 
 // Fill the inflow boundary of a velocity MF
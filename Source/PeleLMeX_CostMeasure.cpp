@@ -0,0 +1,293 @@
+#include <PeleLMeX_CostMeasure.H>
+#include <AMReX_Gpu.H>
+#include <AMReX_ParallelContext.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
+#include <AMReX_Print.H>
+#include <algorithm>
+#include <iomanip>
+#include <string>
+
+using namespace amrex;
+
+namespace {
+// Cost of a box from the costs of the a_srcBA boxes it overlaps
+Real
+overlapCost(
+  const BoxArray& a_srcBA, const Vector<Real>& a_srcCosts, const Box& a_bx)
+{
+  Real cost = 0.0;
+  if (a_srcCosts.empty()) {
+    return cost;
+  }
+  for (const auto& is : a_srcBA.intersections(a_bx)) {
+    cost += a_srcCosts[is.first] * static_cast<Real>(is.second.numPts()) /
+            static_cast<Real>(a_srcBA[is.first].numPts());
+  }
+  return cost;
+}
+} // namespace
+
+void
+CostMeasure::define(int a_nlevels, bool a_active)
+{
+  m_active = a_active;
+  m_costs.clear();
+  m_costs.resize(a_nlevels);
+  m_chemCosts.clear();
+  m_chemCosts.resize(a_nlevels);
+  m_baChem.clear();
+  m_baChem.resize(a_nlevels);
+  m_nsteps.assign(a_nlevels, 0);
+  m_rankCosts.fill(0.0);
+}
+
+Real
+CostMeasure::start() const
+{
+  if (!m_active) {
+    return 0.0;
+  }
+  Gpu::streamSynchronize();
+  return ParallelDescriptor::second();
+}
+
+void
+CostMeasure::stop(int lev, const MFIter& mfi, Real a_t0, int a_kernel)
+{
+  if (!m_active || !m_costs[lev]) {
+    return;
+  }
+  Gpu::streamSynchronize();
+  const Real elapsed = ParallelDescriptor::second() - a_t0;
+  AMREX_ASSERT(m_costs[lev]->localindex(mfi.index()) >= 0);
+  Real& boxCost = (*m_costs[lev])[mfi.index()];
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+  boxCost += elapsed;
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+  m_rankCosts[a_kernel] += elapsed;
+}
+
+void
+CostMeasure::stopChem(int lev, const MFIter& mfi, Real a_t0)
+{
+  if (!m_active) {
+    return;
+  }
+  Gpu::streamSynchronize();
+  const Real elapsed = ParallelDescriptor::second() - a_t0;
+  AMREX_ASSERT(mfi.index() < m_chemCosts[lev].size());
+  Real& boxCost = m_chemCosts[lev][mfi.index()];
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+  boxCost += elapsed;
+#ifdef AMREX_USE_OMP
+#pragma omp atomic
+#endif
+  m_rankCosts[Chemistry] += elapsed;
+}
+
+void
+CostMeasure::defineLevel(
+  int lev, const BoxArray& ba, const DistributionMapping& dm)
+{
+  if (!m_active) {
+    return;
+  }
+  m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
+  for (MFIter mfi(*m_costs[lev], false); mfi.isValid(); ++mfi) {
+    (*m_costs[lev])[mfi] = 0.0;
+  }
+  m_chemCosts[lev].clear();
+  m_baChem[lev] = BoxArray();
+  m_nsteps[lev] = 0;
+}
+
+void
+CostMeasure::remapLevel(
+  int lev, const BoxArray& ba, const DistributionMapping& dm)
+{
+  if (!m_active) {
+    return;
+  }
+  if (!m_costs[lev]) {
+    defineLevel(lev, ba, dm);
+    return;
+  }
+
+  // The chemistry costs are folded in: the chemistry layout will be rebuilt
+  Vector<Real> costs;
+  Vector<Real> chemCosts;
+  gatherLevel(lev, costs, chemCosts);
+
+  auto new_costs = std::make_unique<LayoutData<Real>>(ba, dm);
+  for (MFIter mfi(*new_costs, false); mfi.isValid(); ++mfi) {
+    (*new_costs)[mfi] =
+      overlapCost(m_costs[lev]->boxArray(), costs, mfi.validbox()) +
+      overlapCost(m_baChem[lev], chemCosts, mfi.validbox());
+  }
+  m_costs[lev] = std::move(new_costs);
+  std::fill(m_chemCosts[lev].begin(), m_chemCosts[lev].end(), 0.0);
+}
+
+void
+CostMeasure::resetChemLevel(int lev, const BoxArray& a_baChem)
+{
+  if (!m_active) {
+    return;
+  }
+  if (m_costs[lev] && !m_chemCosts[lev].empty()) {
+    Vector<Real> chemCosts = m_chemCosts[lev];
+    ParallelAllReduce::Sum(
+      chemCosts.data(), static_cast<int>(chemCosts.size()),
+      ParallelContext::CommunicatorSub());
+    for (MFIter mfi(*m_costs[lev], false); mfi.isValid(); ++mfi) {
+      (*m_costs[lev])[mfi] +=
+        overlapCost(m_baChem[lev], chemCosts, mfi.validbox());
+    }
+  }
+  m_baChem[lev] = a_baChem;
+  m_chemCosts[lev].assign(a_baChem.size(), 0.0);
+}
+
+void
+CostMeasure::clearLevel(int lev)
+{
+  if (lev >= m_costs.size()) {
+    return;
+  }
+  m_costs[lev].reset();
+  m_chemCosts[lev].clear();
+  m_baChem[lev] = BoxArray();
+  m_nsteps[lev] = 0;
+}
+
+void
+CostMeasure::addStep()
+{
+  if (!m_active) {
+    return;
+  }
+  for (int lev = 0; lev < m_costs.size(); ++lev) {
+    if (m_costs[lev]) {
+      m_nsteps[lev] += 1;
+    }
+  }
+}
+
+bool
+CostMeasure::getCosts(int lev, LayoutData<Real>& a_costs) const
+{
+  if (!m_active || !m_costs[lev] || m_nsteps[lev] == 0) {
+    return false;
+  }
+
+  Vector<Real> costs;
+  Vector<Real> chemCosts;
+  gatherLevel(lev, costs, chemCosts);
+
+  Real totalCost = 0.0;
+  for (const auto& c : costs) {
+    totalCost += c;
+  }
+  for (const auto& c : chemCosts) {
+    totalCost += c;
+  }
+  if (totalCost <= 0.0) {
+    return false;
+  }
+
+  const Real scale = 1.0 / static_cast<Real>(m_nsteps[lev]);
+  for (MFIter mfi(a_costs, false); mfi.isValid(); ++mfi) {
+    a_costs[mfi] =
+      scale * (overlapCost(m_costs[lev]->boxArray(), costs, mfi.validbox()) +
+               overlapCost(m_baChem[lev], chemCosts, mfi.validbox()));
+  }
+  return true;
+}
+
+void
+CostMeasure::gatherLevel(
+  int lev, Vector<Real>& a_costs, Vector<Real>& a_chemCosts) const
+{
+  a_costs.resize(m_costs[lev]->boxArray().size());
+  ParallelDescriptor::GatherLayoutDataToVector(
+    *m_costs[lev], a_costs, ParallelContext::IOProcessorNumberSub());
+  ParallelDescriptor::Bcast(
+    a_costs.data(), a_costs.size(), ParallelContext::IOProcessorNumberSub());
+
+  // Each rank only filled the entries of the chemistry boxes it owns
+  a_chemCosts = m_chemCosts[lev];
+  if (!a_chemCosts.empty()) {
+    ParallelAllReduce::Sum(
+      a_chemCosts.data(), static_cast<int>(a_chemCosts.size()),
+      ParallelContext::CommunicatorSub());
+  }
+}
+
+void
+CostMeasure::printReport(int a_nbins)
+{
+  if (!m_active) {
+    return;
+  }
+
+  const int nprocs = ParallelDescriptor::NProcs();
+  const int ioproc = ParallelDescriptor::IOProcessorNumber();
+  const Array<std::string, NKernels> names{
+    "Advection", "Diffusion", "Chemistry", "Redistribution"};
+
+  Real rankTotal = 0.0;
+  for (const auto& c : m_rankCosts) {
+    rankTotal += c;
+  }
+  Array<Real, NKernels> kmin = m_rankCosts;
+  Array<Real, NKernels> kmax = m_rankCosts;
+  Array<Real, NKernels> ksum = m_rankCosts;
+  ParallelDescriptor::ReduceRealMin(kmin.data(), NKernels, ioproc);
+  ParallelDescriptor::ReduceRealMax(kmax.data(), NKernels, ioproc);
+  ParallelDescriptor::ReduceRealSum(ksum.data(), NKernels, ioproc);
+  Vector<Real> totals(nprocs, 0.0);
+  ParallelDescriptor::Gather(&rankTotal, 1, totals.data(), 1, ioproc);
+
+  if (ParallelDescriptor::IOProcessor()) {
+    Print() << " Measured per-rank kernel time [s] (min / avg / max):\n";
+    for (int k = 0; k < NKernels; ++k) {
+      Print() << "   " << std::setw(15) << std::left << names[k] << kmin[k]
+              << " / " << ksum[k] / static_cast<Real>(nprocs) << " / "
+              << kmax[k] << "\n";
+    }
+
+    const Real tmin = *std::min_element(totals.begin(), totals.end());
+    const Real tmax = *std::max_element(totals.begin(), totals.end());
+    Real tavg = 0.0;
+    for (const auto& t : totals) {
+      tavg += t / static_cast<Real>(nprocs);
+    }
+    Print() << " Per-rank total time histogram, max/avg: "
+            << ((tavg > 0.0) ? tmax / tavg : 1.0) << "\n";
+    const Real width = (tmax - tmin) / static_cast<Real>(a_nbins);
+    Vector<int> counts(a_nbins, 0);
+    for (const auto& t : totals) {
+      const int bin =
+        (width > 0.0)
+          ? std::min(static_cast<int>((t - tmin) / width), a_nbins - 1)
+          : 0;
+      counts[bin] += 1;
+    }
+    for (int b = 0; b < a_nbins; ++b) {
+      Print() << "   [" << tmin + b * width << ", " << tmin + (b + 1) * width
+              << "] " << std::setw(6) << std::right << counts[b] << " "
+              << std::string(
+                   static_cast<std::size_t>(std::min(counts[b], 50)), '#')
+              << "\n";
+    }
+  }
+
+  m_rankCosts.fill(0.0);
+}
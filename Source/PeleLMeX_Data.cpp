@@ -2,6 +2,27 @@
 
 using namespace amrex;
 
+namespace {
+// Define a MF, recycling a pooled one if a pool is available
+void
+definePooled(
+  MFPool* a_pool,
+  int lev,
+  MultiFab& a_mf,
+  const BoxArray& ba,
+  const DistributionMapping& dm,
+  int ncomp,
+  int ngrow,
+  const FabFactory<FArrayBox>& factory)
+{
+  if (a_pool != nullptr) {
+    a_mf = a_pool->acquire(lev, ba, dm, ncomp, ngrow, factory);
+  } else {
+    a_mf.define(ba, dm, ncomp, ngrow, MFInfo(), factory);
+  }
+}
+} // namespace
+
 PeleLM::LevelData::LevelData(
   amrex::BoxArray const& ba,
   amrex::DistributionMapping const& dm,
@@ -11,7 +32,8 @@ PeleLM::LevelData::LevelData(
   int a_nAux,
   int a_nGrowState,
   int a_use_soret,
-  int a_do_les)
+  int a_do_les,
+  int a_store_diff)
 {
   if (a_incompressible != 0) {
     state.define(ba, dm, AMREX_SPACEDIM, a_nGrowState, MFInfo(), factory);
@@ -24,6 +46,15 @@ PeleLM::LevelData::LevelData(
   visc_cc.define(ba, dm, 1, 1, MFInfo(), factory);
   if (a_do_les != 0) {
     for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+#ifdef PELE_USE_FLOAT_AUX
+      // Single precision FabArrays cannot use the (EB) MultiFab factory
+      visc_turb_fc[i].define(
+        amrex::convert(ba, IntVect::TheDimensionVector(i)), dm, 1, 0);
+      if (a_incompressible == 0) {
+        lambda_turb_fc[i].define(
+          amrex::convert(ba, IntVect::TheDimensionVector(i)), dm, 1, 0);
+      }
+#else
       visc_turb_fc[i].define(
         amrex::convert(ba, IntVect::TheDimensionVector(i)), dm, 1, 0, MFInfo(),
         factory);
@@ -32,16 +63,19 @@ PeleLM::LevelData::LevelData(
           amrex::convert(ba, IntVect::TheDimensionVector(i)), dm, 1, 0,
           MFInfo(), factory);
       }
+#endif
     }
   }
   if (a_incompressible == 0) {
     if (a_has_divu != 0) {
       divu.define(ba, dm, 1, 1, MFInfo(), factory);
     }
-    if (a_use_soret != 0) {
-      diff_cc.define(ba, dm, 2 * NUM_SPECIES + 2, 1, MFInfo(), factory);
-    } else {
-      diff_cc.define(ba, dm, NUM_SPECIES + 2, 1, MFInfo(), factory);
+    if (a_store_diff != 0) {
+      if (a_use_soret != 0) {
+        diff_cc.define(ba, dm, 2 * NUM_SPECIES + 2, 1, MFInfo(), factory);
+      } else {
+        diff_cc.define(ba, dm, NUM_SPECIES + 2, 1, MFInfo(), factory);
+      }
     }
 
 #ifdef PELE_USE_EFIELD
@@ -65,7 +99,11 @@ PeleLM::LevelDataReact::LevelDataReact(
   IRsize += 1;
 #endif
   I_R.define(ba, dm, IRsize, 0, MFInfo(), factory);
+#ifdef PELE_USE_FLOAT_AUX
+  functC.define(ba, dm, 1, 0);
+#else
   functC.define(ba, dm, 1, 0, MFInfo(), factory);
+#endif
 }
 
 #ifdef PELE_USE_EFIELD
@@ -78,6 +116,8 @@ PeleLM::LevelDataNLSolve::LevelDataNLSolve(
   nlState.define(ba, dm, 2, a_nGrow, MFInfo(), factory);
   nlResid.define(ba, dm, 2, a_nGrow, MFInfo(), factory);
   backgroundCharge.define(ba, dm, 1, 0, MFInfo(), factory);
+  nlStateBack.define(ba, dm, 2, 0, MFInfo(), factory);
+  nlStateSDC.define(ba, dm, 2, 0, MFInfo(), factory);
   for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
     const BoxArray& faceba =
       amrex::convert(ba, IntVect::TheDimensionVector(idim));
@@ -96,7 +136,9 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(
   int nGrowAdv,
   int a_use_wbar,
   int a_use_soret,
-  int is_init)
+  int is_init,
+  MFPool* a_pool)
+  : m_pool(a_pool)
 {
   if (is_init != 0) { // All I need is a container for a single diffusion term
     // Resize Vectors
@@ -104,8 +146,9 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(
 
     // Define MFs
     for (int lev = 0; lev <= a_finestLevel; lev++) {
-      Dnp1[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, Dnp1[lev], ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv,
+        *factory[lev]);
     }
   } else {
     // Resize Vectors
@@ -123,30 +166,37 @@ PeleLM::AdvanceDiffData::AdvanceDiffData(
 
     // Define MFs
     for (int lev = 0; lev <= a_finestLevel; lev++) {
-      Dn[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv, MFInfo(), *factory[lev]);
-      Dnp1[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv, MFInfo(), *factory[lev]);
-      Dhat[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, Dn[lev], ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv,
+        *factory[lev]);
+      definePooled(
+        a_pool, lev, Dnp1[lev], ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv,
+        *factory[lev]);
+      definePooled(
+        a_pool, lev, Dhat[lev], ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv,
+        *factory[lev]);
       if (a_use_wbar != 0) {
-        Dwbar[lev].define(
-          ba[lev], dm[lev], NUM_SPECIES, nGrowAdv, MFInfo(), *factory[lev]);
+        definePooled(
+          a_pool, lev, Dwbar[lev], ba[lev], dm[lev], NUM_SPECIES, nGrowAdv,
+          *factory[lev]);
         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
           const BoxArray& faceba =
             amrex::convert(ba[lev], IntVect::TheDimensionVector(idim));
-          wbar_fluxes[lev][idim].define(
-            faceba, dm[lev], NUM_SPECIES, 0, MFInfo(), *factory[lev]);
+          definePooled(
+            a_pool, lev, wbar_fluxes[lev][idim], faceba, dm[lev], NUM_SPECIES,
+            0, *factory[lev]);
         }
       }
       if (a_use_soret != 0) {
-        DT[lev].define(
-          ba[lev], dm[lev], NUM_SPECIES, nGrowAdv, MFInfo(), *factory[lev]);
+        definePooled(
+          a_pool, lev, DT[lev], ba[lev], dm[lev], NUM_SPECIES, nGrowAdv,
+          *factory[lev]);
         for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
           const BoxArray& faceba =
             amrex::convert(ba[lev], IntVect::TheDimensionVector(idim));
-          soret_fluxes[lev][idim].define(
-            faceba, dm[lev], NUM_SPECIES, 0, MFInfo(), *factory[lev]);
+          definePooled(
+            a_pool, lev, soret_fluxes[lev][idim], faceba, dm[lev], NUM_SPECIES,
+            0, *factory[lev]);
         }
       }
     }
@@ -160,7 +210,9 @@ PeleLM::AdvanceAdvData::AdvanceAdvData(
   const amrex::Vector<std::unique_ptr<amrex::FabFactory<FArrayBox>>>& factory,
   int a_incompressible,
   int nGrowAdv,
-  int nGrowMAC)
+  int nGrowMAC,
+  MFPool* a_pool)
+  : m_pool(a_pool)
 {
   // Resize Vectors
   umac.resize(a_finestLevel + 1);
@@ -179,34 +231,67 @@ PeleLM::AdvanceAdvData::AdvanceAdvData(
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
       const BoxArray& faceba =
         amrex::convert(ba[lev], IntVect::TheDimensionVector(idim));
-      umac[lev][idim].define(
-        faceba, dm[lev], 1, nGrowMAC, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, umac[lev][idim], faceba, dm[lev], 1, nGrowMAC,
+        *factory[lev]);
 #ifdef PELE_USE_EFIELD
-      uDrift[lev][idim].define(
-        faceba, dm[lev], NUM_IONS, nGrowMAC, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, uDrift[lev][idim], faceba, dm[lev], NUM_IONS, nGrowMAC,
+        *factory[lev]);
 #endif
     }
     if (a_incompressible != 0) {
-      AofS[lev].define(
-        ba[lev], dm[lev], AMREX_SPACEDIM, 0, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, AofS[lev], ba[lev], dm[lev], AMREX_SPACEDIM, 0,
+        *factory[lev]);
     } else {
-      AofS[lev].define(ba[lev], dm[lev], NVAR, 0, MFInfo(), *factory[lev]);
-      chi[lev].define(ba[lev], dm[lev], 1, 1, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, AofS[lev], ba[lev], dm[lev], NVAR, 0, *factory[lev]);
+      definePooled(
+        a_pool, lev, chi[lev], ba[lev], dm[lev], 1, 1, *factory[lev]);
 #ifdef PELE_USE_EFIELD
-      Forcing[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv, MFInfo(),
+      definePooled(
+        a_pool, lev, Forcing[lev], ba[lev], dm[lev], NUM_SPECIES + 2, nGrowAdv,
         *factory[lev]); // Species + TEMP + nE
 #else
-      Forcing[lev].define(
-        ba[lev], dm[lev], NUM_SPECIES + 1, nGrowAdv, MFInfo(),
+      definePooled(
+        a_pool, lev, Forcing[lev], ba[lev], dm[lev], NUM_SPECIES + 1, nGrowAdv,
         *factory[lev]); // Species + TEMP
 #endif
-      mac_divu[lev].define(
-        ba[lev], dm[lev], 1, nGrowAdv, MFInfo(), *factory[lev]);
+      definePooled(
+        a_pool, lev, mac_divu[lev], ba[lev], dm[lev], 1, nGrowAdv,
+        *factory[lev]);
     }
   }
 }
 
+PeleLM::AdvanceDiffData::~AdvanceDiffData()
+{
+  if (m_pool != nullptr) {
+    m_pool->release(Dn);
+    m_pool->release(Dnp1);
+    m_pool->release(Dhat);
+    m_pool->release(Dwbar);
+    m_pool->release(wbar_fluxes);
+    m_pool->release(DT);
+    m_pool->release(soret_fluxes);
+  }
+}
+
+PeleLM::AdvanceAdvData::~AdvanceAdvData()
+{
+  if (m_pool != nullptr) {
+    m_pool->release(umac);
+    m_pool->release(AofS);
+    m_pool->release(chi);
+    m_pool->release(Forcing);
+    m_pool->release(mac_divu);
+#ifdef PELE_USE_EFIELD
+    m_pool->release(uDrift);
+#endif
+  }
+}
+
 void
 PeleLM::copyStateNewToOld(int nGhost)
 {
@@ -266,13 +351,25 @@ PeleLM::copyStateOldToNew(int nGhost)
 void
 PeleLM::copyTransportOldToNew()
 {
+  // Shared diffusivity container: New coefficients are the Old ones
+  if (m_incompressible == 0 && m_lowMemTransport != 0) {
+    ensureDiffusivity(AmrOldTime);
+    m_sharedDiffHolds = 3;
+  }
+
   for (int lev = 0; lev <= finest_level; lev++) {
     MultiFab::Copy(
       m_leveldata_new[lev]->visc_cc, m_leveldata_old[lev]->visc_cc, 0, 0, 1, 1);
     if (m_incompressible == 0) {
-      MultiFab::Copy(
-        m_leveldata_new[lev]->diff_cc, m_leveldata_old[lev]->diff_cc, 0, 0,
-        NUM_SPECIES + 2, 1);
+      if (m_lowMemTransport == 0) {
+        // Lagged coefficients: the Soret ones are also reused
+        const int ncomp = (m_laggedTransportTol > 0.0)
+                            ? m_leveldata_new[lev]->diff_cc.nComp()
+                            : NUM_SPECIES + 2;
+        MultiFab::Copy(
+          m_leveldata_new[lev]->diff_cc, m_leveldata_old[lev]->diff_cc, 0, 0,
+          ncomp, 1);
+      }
 #ifdef PELE_USE_EFIELD
       MultiFab::Copy(
         m_leveldata_new[lev]->diffE_cc, m_leveldata_old[lev]->diffE_cc, 0, 0, 1,
@@ -286,6 +383,8 @@ PeleLM::copyTransportOldToNew()
 #endif
     }
   }
+
+  resetLaggedTransport();
 }
 
 void
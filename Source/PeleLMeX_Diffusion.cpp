@@ -70,9 +70,9 @@ PeleLM::computeDifferentialDiffusionTerms(
     const auto& ba = grids[lev];
     const auto& factory = Factory(lev);
     for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
-      fluxes[lev][idim].define(
-        amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
-        NUM_SPECIES + 2, nGrow, MFInfo(), factory);
+      fluxes[lev][idim] = m_mfPool.acquire(
+        lev, amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
+        NUM_SPECIES + 2, nGrow, factory);
     }
   }
 #ifdef AMREX_USE_EB
@@ -111,8 +111,7 @@ PeleLM::computeDifferentialDiffusionTerms(
   // If doing species balances, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
   // Factor for SDC is 0.5 is for Dn and -0.5 for Dnp1
-  if (
-    (m_sdcIter == 0 || m_sdcIter == m_nSDCmax) && (m_do_speciesBalance != 0)) {
+  if ((m_sdcIter == 0 || isLastSDCIter()) && (m_do_speciesBalance != 0)) {
     Real sdc_weight = (a_time == AmrOldTime) ? 0.5 : -0.5;
     addRhoYFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0], sdc_weight);
   }
@@ -202,6 +201,34 @@ PeleLM::computeDifferentialDiffusionTerms(
     }
   }
 #endif
+
+  m_mfPool.release(fluxes);
+}
+
+void
+PeleLM::computeDivUDiffusionFluxes(
+  const TimeStamp& a_time,
+  const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_fluxes)
+{
+  BL_PROFILE("PeleLMeX::computeDivUDiffusionFluxes()");
+
+  AMREX_ASSERT((a_time == AmrOldTime) || (a_time == AmrNewTime));
+  AMREX_ASSERT(a_fluxes[0][0]->nComp() >= NUM_SPECIES + 2);
+
+  // Only the total species fluxes are needed, the Wbar and Soret
+  // contributions are not returned separately
+  computeDifferentialDiffusionFluxes(a_time, a_fluxes, {}, {}, {});
+
+  // Species balances face domain integrals, see
+  // computeDifferentialDiffusionTerms
+  if ((m_sdcIter == 0 || isLastSDCIter()) && (m_do_speciesBalance != 0)) {
+    Real sdc_weight = (a_time == AmrOldTime) ? 0.5 : -0.5;
+    Array<const MultiFab*, AMREX_SPACEDIM> fluxesLev0;
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      fluxesLev0[idim] = a_fluxes[0][idim];
+    }
+    addRhoYFluxes(fluxesLev0, geom[0], sdc_weight);
+  }
 }
 
 void
@@ -257,8 +284,15 @@ PeleLM::computeDifferentialDiffusionFluxes(
       do_avgDown);
 #endif
 
-  // Add the wbar term
-  if (m_use_wbar != 0) {
+  // Add the wbar term, or the whole non-Fickian part of the multi-component
+  // fluxes
+  if (m_multiCompDiff != 0) {
+    addMultiComponentTerm(
+      a_fluxes, a_wbarfluxes, GetVecOfConstPtrs(getSpeciesVect(a_time)),
+      GetVecOfConstPtrs(getDensityVect(a_time)),
+      GetVecOfConstPtrs(getTempVect(a_time)),
+      GetVecOfConstPtrs(getDiffusivityVect(a_time)));
+  } else if (m_use_wbar != 0) {
     int need_wbar_fluxes = (a_wbarfluxes.empty()) ? 0 : 1;
     if (need_wbar_fluxes == 0) {
       addWbarTerm(
@@ -426,6 +460,7 @@ PeleLM::addWbarTerm(
 #endif
     {
       for (MFIter mfi(*a_beta[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Real t0 = m_costMeasure.start();
         for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
 
           // Get edge centered rhoYs
@@ -493,6 +528,199 @@ PeleLM::addWbarTerm(
               }
             });
         }
+        m_costMeasure.stop(lev, mfi, t0, CostMeasure::Diffusion);
+      }
+    }
+  }
+}
+
+void
+PeleLM::addMultiComponentTerm(
+  const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_spfluxes,
+  const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_spmcfluxes,
+  Vector<MultiFab const*> const& a_spec,
+  Vector<MultiFab const*> const& a_rho,
+  Vector<MultiFab const*> const& a_temp,
+  Vector<MultiFab const*> const& a_beta)
+{
+  BL_PROFILE("PeleLMeX::addMultiComponentTerm()");
+
+  AMREX_ASSERT(m_transportTable.isDefined());
+
+  //------------------------------------------------------------------------
+  // if a container for the non-Fickian fluxes is provided, fill it
+  int need_mc_fluxes = (a_spmcfluxes.empty()) ? 0 : 1;
+
+  //------------------------------------------------------------------------
+  // Compute Wbar on all the levels
+  int nGrow = 1; // Need one ghost cell to compute gradWbar
+  Vector<MultiFab> Wbar(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+
+    Wbar[lev].define(grids[lev], dmap[lev], 1, nGrow, MFInfo(), Factory(lev));
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(Wbar[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& gbx = mfi.growntilebox();
+      auto const& rho_arr = a_rho[lev]->const_array(mfi);
+      auto const& rhoY_arr = a_spec[lev]->const_array(mfi);
+      auto const& Wbar_arr = Wbar[lev].array(mfi);
+      amrex::ParallelFor(
+        gbx, [rho_arr, rhoY_arr,
+              Wbar_arr] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          getMwmixGivenRY(i, j, k, rho_arr, rhoY_arr, Wbar_arr);
+        });
+    }
+  }
+
+  //------------------------------------------------------------------------
+  // Compute Wbar gradients, consistent across levels
+  int do_avgDown = 1;
+  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
+  auto bcRecTemp = fetchBCRecArray(TEMP, 1);
+
+  nGrow = 0; // No need for ghost face on fluxes
+  Vector<Array<MultiFab, AMREX_SPACEDIM>> gradWbar(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    const auto& ba = grids[lev];
+    const auto& factory = Factory(lev);
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      gradWbar[lev][idim].define(
+        amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev], 1,
+        nGrow, MFInfo(), factory);
+      gradWbar[lev][idim].setVal(0.0);
+    }
+  }
+  getDiffusionOp()->computeGradient(
+    GetVecOfArrOfPtrs(gradWbar), {}, // Don't need the laplacian out
+    GetVecOfConstPtrs(Wbar), bcRecSpec[0], do_avgDown);
+
+  //------------------------------------------------------------------------
+  // Replace the Fickian fluxes - \rho D_m \nabla Y_m by the Stefan-Maxwell
+  // fluxes, the mole fractions gradients being recovered from the former
+  const TransportTableData tab = m_transportTable.data();
+  for (int lev = 0; lev <= finest_level; ++lev) {
+
+    // Get edge diffusivity
+    int doZeroVisc = 1;
+    int addTurbContrib = 0;
+    Array<MultiFab, AMREX_SPACEDIM> beta_ec = getDiffusivity(
+      lev, 0, NUM_SPECIES, doZeroVisc, bcRecSpec, *a_beta[lev], addTurbContrib);
+
+    const Box& domain = geom[lev].Domain();
+    bool use_harmonic_avg = m_harm_avg_cen2edge != 0;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    {
+      for (MFIter mfi(*a_beta[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Real t0 = m_costMeasure.start();
+        for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+
+          // Get edge centered rhoYs and T
+          const Box ebx = mfi.nodaltilebox(idim);
+          FArrayBox rhoY_ed(ebx, NUM_SPECIES, The_Async_Arena());
+          FArrayBox T_ed(ebx, 1, The_Async_Arena());
+
+          const Box& edomain = amrex::surroundingNodes(domain, idim);
+          auto const& rhoY_arr = a_spec[lev]->const_array(mfi);
+          auto const& T_arr = a_temp[lev]->const_array(mfi);
+          const auto& rhoYed_arr = rhoY_ed.array(0);
+          const auto& Ted_arr = T_ed.array(0);
+          const auto bc_lo = bcRecSpec[0].lo(idim);
+          const auto bc_hi = bcRecSpec[0].hi(idim);
+          const auto bcT_lo = bcRecTemp[0].lo(idim);
+          const auto bcT_hi = bcRecTemp[0].hi(idim);
+          amrex::ParallelFor(
+            ebx, [idim, bc_lo, bc_hi, bcT_lo, bcT_hi, use_harmonic_avg,
+                  rhoY_arr, rhoYed_arr, T_arr, Ted_arr,
+                  edomain] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              int idx[3] = {i, j, k};
+              bool on_lo =
+                ((bc_lo == amrex::BCType::ext_dir) &&
+                 (idx[idim] <= edomain.smallEnd(idim)));
+              bool on_hi =
+                ((bc_hi == amrex::BCType::ext_dir) &&
+                 (idx[idim] >= edomain.bigEnd(idim)));
+              cen2edg_cpp(
+                i, j, k, idim, NUM_SPECIES, use_harmonic_avg, on_lo, on_hi,
+                rhoY_arr, rhoYed_arr);
+              on_lo =
+                ((bcT_lo == amrex::BCType::ext_dir) &&
+                 (idx[idim] <= edomain.smallEnd(idim)));
+              on_hi =
+                ((bcT_hi == amrex::BCType::ext_dir) &&
+                 (idx[idim] >= edomain.bigEnd(idim)));
+              cen2edg_cpp(
+                i, j, k, idim, 1, false, on_lo, on_hi, T_arr, Ted_arr);
+            });
+
+          auto const& rhoY = rhoY_ed.const_array(0);
+          auto const& Ted = T_ed.const_array(0);
+          auto const& gradWbar_ar = gradWbar[lev][idim].const_array(mfi);
+          auto const& beta_ar = beta_ec[idim].const_array(mfi);
+          auto const& spFlux_ar = a_spfluxes[lev][idim]->array(mfi);
+          auto const& spmcFlux_ar =
+            (need_mc_fluxes) != 0
+              ? a_spmcfluxes[lev][idim]->array(mfi)
+              : a_spfluxes[lev][idim]->array(mfi); // Dummy unused Array4
+
+          amrex::ParallelFor(
+            ebx,
+            [need_mc_fluxes, gradWbar_ar, beta_ar, rhoY, Ted, spFlux_ar,
+             spmcFlux_ar, tab] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              auto eos = pele::physics::PhysicsType::eos();
+              amrex::Real mwt[NUM_SPECIES] = {0.0};
+              eos.molecular_weight(mwt);
+
+              // Faces with a zero diffusivity (walls) keep their fluxes
+              bool has_diff = true;
+              for (int n = 0; n < NUM_SPECIES; n++) {
+                has_diff = has_diff && (beta_ar(i, j, k, n) > 0.0);
+              }
+
+              amrex::Real mcFlux[NUM_SPECIES] = {0.0};
+              if (has_diff) {
+                amrex::Real rho = 0.0;
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  rho += rhoY(i, j, k, n);
+                }
+                amrex::Real rho_inv = 1.0 / rho;
+                amrex::Real y[NUM_SPECIES] = {0.0};
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  y[n] = rhoY(i, j, k, n) * rho_inv;
+                }
+                amrex::Real WBAR = 0.0;
+                eos.Y2WBAR(y, WBAR);
+
+                // X_m = Y_m Wbar / W_m, the Wbar gradient is in kg/mol/m
+                amrex::Real x[NUM_SPECIES] = {0.0};
+                amrex::Real gradX[NUM_SPECIES] = {0.0};
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  const amrex::Real gradY =
+                    -spFlux_ar(i, j, k, n) / beta_ar(i, j, k, n);
+                  x[n] = y[n] * WBAR / mwt[n];
+                  gradX[n] =
+                    (WBAR * gradY + 1000.0 * y[n] * gradWbar_ar(i, j, k)) /
+                    mwt[n];
+                }
+                getStefanMaxwellFluxes(Ted(i, j, k), x, gradX, tab, mcFlux);
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  mcFlux[n] -= spFlux_ar(i, j, k, n);
+                  spFlux_ar(i, j, k, n) += mcFlux[n];
+                }
+              }
+              if (need_mc_fluxes != 0) {
+                for (int n = 0; n < NUM_SPECIES; n++) {
+                  spmcFlux_ar(i, j, k, n) = mcFlux[n];
+                }
+              }
+            });
+        }
+        m_costMeasure.stop(lev, mfi, t0, CostMeasure::Diffusion);
       }
     }
   }
@@ -552,6 +780,7 @@ PeleLM::addSoretTerm(
       FArrayBox rhoY_ed;
       FArrayBox T_ed;
       for (MFIter mfi(*a_beta[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Real t0 = m_costMeasure.start();
         for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
 
           // Get edge centered rhoYs
@@ -632,6 +861,7 @@ PeleLM::addSoretTerm(
               }
             });
         }
+        m_costMeasure.stop(lev, mfi, t0, CostMeasure::Diffusion);
       }
     }
   }
@@ -745,6 +975,108 @@ PeleLM::adjustSpeciesFluxes(
   }
 }
 
+void
+PeleLM::correctSpeciesFluxesFused(
+  int lev,
+  const Array<MultiFab*, AMREX_SPACEDIM>& a_spfluxes,
+  const MultiFab& a_spec,
+  std::unique_ptr<AdvanceDiffData>& diffData,
+  MultiFab* a_divergence)
+{
+  BL_PROFILE("PeleLMeX::correctSpeciesFluxesFused()");
+
+  // Get the species BCRec
+  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
+
+  const Box& domain = geom[lev].Domain();
+  const bool doDiv = (a_divergence != nullptr);
+
+  // Divergence pieces
+  MultiFab volume;
+  const Real* dx = Geom(lev).CellSize();
+#if (AMREX_SPACEDIM == 2)
+  Real areax = dx[1];
+  Real areay = dx[0];
+#elif (AMREX_SPACEDIM == 3)
+  Real areax = dx[1] * dx[2];
+  Real areay = dx[0] * dx[2];
+  Real areaz = dx[0] * dx[1];
+#endif
+  if (doDiv) {
+    AMREX_ASSERT(!geom[lev].IsRZ());
+    volume.define(grids[lev], dmap[lev], 1, 0);
+    geom[lev].GetVolume(volume);
+  }
+
+  // The divergence needs all the faces of the tile to be corrected: loop
+  // over boxes so that no face is shared between threads
+  MFItInfo mfi_info = doDiv ? MFItInfo() : TilingIfNotGPU();
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(a_spec, mfi_info); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.tilebox();
+    auto const& rhoY = a_spec.const_array(mfi);
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+      const Box& ebx = mfi.nodaltilebox(idim);
+      const Box& edomain = amrex::surroundingNodes(domain, idim);
+      auto const& flux_dir = a_spfluxes[idim]->array(mfi);
+      auto const& flux_wbar =
+        (m_use_wbar != 0) ? diffData->wbar_fluxes[lev][idim].const_array(mfi)
+                          : a_spfluxes[idim]->const_array(mfi);
+      auto const& flux_soret =
+        (m_use_soret != 0) ? diffData->soret_fluxes[lev][idim].const_array(mfi)
+                           : a_spfluxes[idim]->const_array(mfi);
+
+      const auto bc_lo = bcRecSpec[0].lo(idim);
+      const auto bc_hi = bcRecSpec[0].hi(idim);
+      amrex::ParallelFor(
+        ebx, [idim, rhoY, flux_dir, flux_wbar, flux_soret, edomain, bc_lo,
+              bc_hi, use_wbar = m_use_wbar,
+              use_soret =
+                m_use_soret] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          // Lagged Wbar and Soret fluxes
+          if (use_wbar != 0) {
+            for (int n = 0; n < NUM_SPECIES; n++) {
+              flux_dir(i, j, k, n) += flux_wbar(i, j, k, n);
+            }
+          }
+          if (use_soret != 0) {
+            for (int n = 0; n < NUM_SPECIES; n++) {
+              flux_dir(i, j, k, n) += flux_soret(i, j, k, n);
+            }
+          }
+
+          // Correction ensuring the species fluxes sum up to zero
+          int idx[3] = {i, j, k};
+          bool on_lo =
+            ((bc_lo == amrex::BCType::ext_dir) &&
+             (idx[idim] <= edomain.smallEnd(idim)));
+          bool on_hi =
+            ((bc_hi == amrex::BCType::ext_dir) &&
+             (idx[idim] >= edomain.bigEnd(idim)));
+          repair_flux(i, j, k, idim, on_lo, on_hi, rhoY, flux_dir);
+        });
+    }
+
+    if (doDiv) {
+      auto const& divergence = a_divergence->array(mfi);
+      auto const& vol = volume.const_array(mfi);
+      AMREX_D_TERM(auto const& fluxX = a_spfluxes[0]->const_array(mfi);
+                   , auto const& fluxY = a_spfluxes[1]->const_array(mfi);
+                   , auto const& fluxZ = a_spfluxes[2]->const_array(mfi););
+      amrex::ParallelFor(
+        bx, [divergence, AMREX_D_DECL(fluxX, fluxY, fluxZ),
+             AMREX_D_DECL(areax, areay, areaz),
+             vol] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          intFluxDivergence_K(
+            i, j, k, NUM_SPECIES, AMREX_D_DECL(fluxX, fluxY, fluxZ),
+            AMREX_D_DECL(areax, areay, areaz), vol, -1.0, divergence);
+        });
+    }
+  }
+}
+
 void
 PeleLM::computeSpeciesEnthalpyFlux(
   const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_fluxes,
@@ -856,9 +1188,9 @@ PeleLM::differentialDiffusionUpdate(
     const auto& ba = grids[lev];
     const auto& factory = Factory(lev);
     for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
-      fluxes[lev][idim].define(
-        amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
-        NUM_SPECIES + 2, nGrow, MFInfo(), factory);
+      fluxes[lev][idim] = m_mfPool.acquire(
+        lev, amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
+        NUM_SPECIES + 2, nGrow, factory);
     }
   }
 #ifdef AMREX_USE_EB
@@ -899,167 +1231,29 @@ PeleLM::differentialDiffusionUpdate(
   }
 
   //------------------------------------------------------------------------
-  // Species diffusion solve
-  // Get the species BCRec
-  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
-
-#ifdef PELE_USE_EFIELD
-  // Solve for \widetilda{rhoY^{np1,kp1}}
-  // -> return the uncorrected fluxes^{np1,kp1}
-  // -> and the partially updated species (not including wbar or flux
-  // correction)
-  getMCDiffusionOp(NUM_SPECIES - NUM_IONS)
-    ->diffuse_scalar(
-      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), 0,
-      GetVecOfConstPtrs(advData->Forcing), 0, GetVecOfArrOfPtrs(fluxes), 0,
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
-      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecSpec,
-      NUM_SPECIES - NUM_IONS, 0, m_dt);
-  // Ions one by one
-  for (int n = 0; n < NUM_IONS; n++) {
-    auto bcRecIons = fetchBCRecArray(FIRSTSPEC + NUM_SPECIES - NUM_IONS + n, 1);
-    getDiffusionOp()->diffuse_scalar(
-      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), NUM_SPECIES - NUM_IONS + n,
-      GetVecOfConstPtrs(advData->Forcing), NUM_SPECIES - NUM_IONS + n,
-      GetVecOfArrOfPtrs(fluxes), NUM_SPECIES - NUM_IONS + n,
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
-      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecIons, 1, 0,
-      m_dt);
-  }
-#else
-  // Solve for \widetilda{rhoY^{np1,kp1}}
-  // -> return the uncorrected fluxes^{np1,kp1}
-  // -> and the partially updated species (not including wbar or flux
-  // correction)
-  getMCDiffusionOp(NUM_SPECIES)
-    ->diffuse_scalar(
-      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), 0,
-      GetVecOfConstPtrs(advData->Forcing), 0, GetVecOfArrOfPtrs(fluxes), 0,
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
-      GetVecOfConstPtrs(
-        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
-      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecSpec,
-      NUM_SPECIES, 0, m_dt);
-#endif
-
-  // Add lagged Wbar term
-  // Computed in computeDifferentialDiffusionTerms at t^{n} if first SDC
-  // iteration, t^{np1,k} otherwise
-  if (m_use_wbar != 0) {
-    for (int lev = 0; lev <= finest_level; ++lev) {
-
-      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-      for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-          const Box& ebx = mfi.nodaltilebox(idim);
-          auto const& flux_spec = fluxes[lev][idim].array(mfi);
-          auto const& flux_wbar =
-            diffData->wbar_fluxes[lev][idim].const_array(mfi);
-          amrex::ParallelFor(
-            ebx, NUM_SPECIES,
-            [flux_spec,
-             flux_wbar] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-              flux_spec(i, j, k, n) += flux_wbar(i, j, k, n);
-            });
-        }
+  // Species diffusion solve. With multi-component diffusion, the lagged
+  // non-Fickian fluxes are re-evaluated at the updated species and the solve
+  // repeated: the implicit mixture-averaged operator then acts as a
+  // preconditioner of the Stefan-Maxwell one.
+  const int mcIterMax = (m_multiCompDiff != 0) ? m_mcDiffMaxIter : 1;
+  for (int mcIter = 0; mcIter < mcIterMax; ++mcIter) {
+    if (mcIter > 0) {
+      const Real mcNorm = updateMultiComponentFluxes(advData, diffData);
+      if (m_mcDiffVerbose != 0) {
+        Print() << "   Multi-component diffusion iter " << mcIter
+                << ", max. dY = " << mcNorm << "\n";
+      }
+      if (mcNorm < m_mcDiffTol) {
+        break;
       }
     }
+    differentialDiffusionSpeciesSolve(
+      advData, diffData, GetVecOfArrOfPtrs(fluxes));
   }
-  if (m_use_soret != 0) {
-    for (int lev = 0; lev <= finest_level; ++lev) {
-      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-      for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
-          const Box& ebx = mfi.nodaltilebox(idim);
-          auto const& flux_spec = fluxes[lev][idim].array(mfi);
-          auto const& flux_soret =
-            diffData->soret_fluxes[lev][idim].const_array(mfi);
-          amrex::ParallelFor(
-            ebx, NUM_SPECIES,
-            [flux_spec,
-             flux_soret] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-              flux_spec(i, j, k, n) += flux_soret(i, j, k, n);
-            });
-        }
-      }
-    }
-  }
-
-  // FillPatch the new species before computing flux correction terms
-  fillPatchSpecies(AmrNewTime);
-
-  // Adjust species diffusion fluxes to ensure their sum is zero
-  adjustSpeciesFluxes(
-    GetVecOfArrOfPtrs(fluxes), GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)));
-
-  // Average down fluxes^{np1,kp1}
-  getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(fluxes), 0, NUM_SPECIES);
-
-  // Compute diffusion term D^{np1,kp1} (or Dhat)
-  fluxDivergence(
-    GetVecOfPtrs(diffData->Dhat), 0, GetVecOfArrOfPtrs(fluxes), 0, NUM_SPECIES,
-    1, -1.0);
-
-  // Update species
-  // Remove the Wbar term because we included it in both the dhat and the
-  // forcing.
-  for (int lev = 0; lev <= finest_level; ++lev) {
-
-    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-    for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-      const Box& bx = mfi.tilebox();
-      auto const& rhoY = ldata_p->state.array(mfi, FIRSTSPEC);
-      auto const& dhat = diffData->Dhat[lev].const_array(mfi);
-      auto const& force = advData->Forcing[lev].const_array(mfi, 0);
-      auto const& dwbar =
-        (m_use_wbar) != 0
-          ? diffData->Dwbar[lev].const_array(mfi)
-          : diffData->Dhat[lev].const_array(mfi); // Dummy unused Array4
-      auto const& dT = (m_use_soret) != 0
-                         ? diffData->DT[lev].const_array(mfi)
-                         : diffData->Dhat[lev].const_array(mfi);
-
-      amrex::ParallelFor(
-        bx, NUM_SPECIES,
-        [rhoY, dhat, force, dwbar, dT, dt = m_dt, use_wbar = m_use_wbar,
-         use_soret =
-           m_use_soret] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-          rhoY(i, j, k, n) = force(i, j, k, n) + dt * dhat(i, j, k, n);
-          if (use_wbar != 0) {
-            rhoY(i, j, k, n) -= dt * dwbar(i, j, k, n);
-          }
-          if (use_soret != 0) {
-            rhoY(i, j, k, n) -= dt * dT(i, j, k, n);
-          }
-        });
-    }
-  }
-
-  // FillPatch species again before going into the enthalpy solve
-  fillPatchSpecies(AmrNewTime);
 
   // If doing species balances, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
-  if (m_sdcIter == m_nSDCmax && (m_do_speciesBalance != 0)) {
+  if (isLastSDCIter() && (m_do_speciesBalance != 0)) {
     addRhoYFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0]);
   }
   //------------------------------------------------------------------------
@@ -1137,9 +1331,29 @@ PeleLM::differentialDiffusionUpdate(
     finest_level + 1); // Storage of T while working on deltaT
   Vector<MultiFab> RhoCp(finest_level + 1); // Acoeff of the linear solve
   for (int lev = 0; lev <= finest_level; ++lev) {
-    rhs[lev].define(grids[lev], dmap[lev], 1, 0, MFInfo(), Factory(lev));
-    Tsave[lev].define(grids[lev], dmap[lev], 1, 1, MFInfo(), Factory(lev));
-    RhoCp[lev].define(grids[lev], dmap[lev], 1, 0, MFInfo(), Factory(lev));
+    rhs[lev] = m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 0, Factory(lev));
+    Tsave[lev] =
+      m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 1, Factory(lev));
+    RhoCp[lev] =
+      m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 0, Factory(lev));
+  }
+
+  // Anderson acceleration history of the increments and fixed point map
+  Vector<Vector<MultiFab>> Fhist;
+  Vector<Vector<MultiFab>> Ghist;
+  if (m_deltaTAndersonDepth > 0) {
+    Fhist.resize(m_deltaTAndersonDepth + 1);
+    Ghist.resize(m_deltaTAndersonDepth + 1);
+    for (int h = 0; h <= m_deltaTAndersonDepth; ++h) {
+      Fhist[h].resize(finest_level + 1);
+      Ghist[h].resize(finest_level + 1);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        Fhist[h][lev] =
+          m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 0, Factory(lev));
+        Ghist[h][lev] =
+          m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 0, Factory(lev));
+      }
+    }
   }
 
   // DeltaT norm
@@ -1147,6 +1361,7 @@ PeleLM::differentialDiffusionUpdate(
   for (int dTiter = 0; dTiter < m_deltaTIterMax &&
                        (dTiter == 0 || deltaT_norm >= m_deltaT_norm_max);
        ++dTiter) {
+    m_deltaTIterStep += 1;
 
     // Prepare the deltaT iteration linear solve:
     // -> Assemble the RHS
@@ -1188,6 +1403,13 @@ PeleLM::differentialDiffusionUpdate(
         bcRecTemp, 1, 0, m_dt);
     }
 
+    // Replace deltaT by the Anderson accelerated increment
+    Real deltaT_rawNorm = 0.0;
+    if (m_deltaTAndersonDepth > 0) {
+      deltaT_rawNorm =
+        deltaTIter_anderson(dTiter, GetVecOfConstPtrs(Tsave), Fhist, Ghist);
+    }
+
     // Post deltaT iteration linear solve
     // -> evaluate deltaT_norm
     // -> add deltaT to T^{np1,kp1}
@@ -1205,6 +1427,8 @@ PeleLM::differentialDiffusionUpdate(
         dTiter, GetVecOfArrOfPtrs(fluxes), {}, GetVecOfConstPtrs(Tsave),
         diffData, deltaT_norm);
     }
+    // Converged only if both the accelerated and raw increments are small
+    deltaT_norm = std::max(deltaT_norm, deltaT_rawNorm);
 
     // Check for convergence failure
     if ((dTiter == m_deltaTIterMax - 1) && (deltaT_norm > m_deltaT_norm_max)) {
@@ -1216,6 +1440,328 @@ PeleLM::differentialDiffusionUpdate(
     }
   }
   //------------------------------------------------------------------------
+
+  m_mfPool.release(rhs);
+  m_mfPool.release(Tsave);
+  m_mfPool.release(RhoCp);
+  for (int h = 0; h < Fhist.size(); ++h) {
+    m_mfPool.release(Fhist[h]);
+    m_mfPool.release(Ghist[h]);
+  }
+  m_mfPool.release(fluxes);
+}
+
+void
+PeleLM::differentialDiffusionSpeciesSolve(
+  std::unique_ptr<AdvanceAdvData>& advData,
+  std::unique_ptr<AdvanceDiffData>& diffData,
+  const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_fluxes)
+{
+  BL_PROFILE("PeleLMeX::differentialDiffusionSpeciesSolve()");
+
+  // Get the species BCRec
+  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
+
+#ifdef PELE_USE_EFIELD
+  // Solve for \widetilda{rhoY^{np1,kp1}}
+  // -> return the uncorrected fluxes^{np1,kp1}
+  // -> and the partially updated species (not including wbar or flux
+  // correction)
+  getMCDiffusionOp(NUM_SPECIES - NUM_IONS)
+    ->diffuse_scalar(
+      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), 0,
+      GetVecOfConstPtrs(advData->Forcing), 0, a_fluxes, 0,
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
+      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecSpec,
+      NUM_SPECIES - NUM_IONS, 0, m_dt);
+  // Ions one by one
+  for (int n = 0; n < NUM_IONS; n++) {
+    auto bcRecIons = fetchBCRecArray(FIRSTSPEC + NUM_SPECIES - NUM_IONS + n, 1);
+    getDiffusionOp()->diffuse_scalar(
+      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), NUM_SPECIES - NUM_IONS + n,
+      GetVecOfConstPtrs(advData->Forcing), NUM_SPECIES - NUM_IONS + n, a_fluxes,
+      NUM_SPECIES - NUM_IONS + n,
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
+      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecIons, 1, 0,
+      m_dt);
+  }
+#else
+  // Solve for \widetilda{rhoY^{np1,kp1}}
+  // -> return the uncorrected fluxes^{np1,kp1}
+  // -> and the partially updated species (not including wbar or flux
+  // correction)
+  getMCDiffusionOp(NUM_SPECIES)
+    ->diffuse_scalar(
+      GetVecOfPtrs(getSpeciesVect(AmrNewTime)), 0,
+      GetVecOfConstPtrs(advData->Forcing), 0, a_fluxes, 0,
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this is the acoeff of LinOp
+      GetVecOfConstPtrs(
+        getDensityVect(AmrNewTime)), // this triggers proper scaling by density
+      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecSpec,
+      NUM_SPECIES, 0, m_dt);
+#endif
+
+  // FillPatch the new species before computing flux correction terms
+  fillPatchSpecies(AmrNewTime);
+
+  // Add the lagged Wbar and Soret terms, correct the species fluxes and get
+  // the diffusion term D^{np1,kp1} (or Dhat)
+  correctSpeciesFluxes(a_fluxes, diffData);
+
+  // Update species
+  // Remove the Wbar term because we included it in both the dhat and the
+  // forcing.
+  for (int lev = 0; lev <= finest_level; ++lev) {
+
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& rhoY = ldata_p->state.array(mfi, FIRSTSPEC);
+      auto const& dhat = diffData->Dhat[lev].const_array(mfi);
+      auto const& force = advData->Forcing[lev].const_array(mfi, 0);
+      auto const& dwbar =
+        (m_use_wbar) != 0
+          ? diffData->Dwbar[lev].const_array(mfi)
+          : diffData->Dhat[lev].const_array(mfi); // Dummy unused Array4
+      auto const& dT = (m_use_soret) != 0
+                         ? diffData->DT[lev].const_array(mfi)
+                         : diffData->Dhat[lev].const_array(mfi);
+
+      amrex::ParallelFor(
+        bx, NUM_SPECIES,
+        [rhoY, dhat, force, dwbar, dT, dt = m_dt, use_wbar = m_use_wbar,
+         use_soret =
+           m_use_soret] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+          rhoY(i, j, k, n) = force(i, j, k, n) + dt * dhat(i, j, k, n);
+          if (use_wbar != 0) {
+            rhoY(i, j, k, n) -= dt * dwbar(i, j, k, n);
+          }
+          if (use_soret != 0) {
+            rhoY(i, j, k, n) -= dt * dT(i, j, k, n);
+          }
+        });
+    }
+  }
+
+  // FillPatch species again before going into the enthalpy solve
+  fillPatchSpecies(AmrNewTime);
+}
+
+void
+PeleLM::correctSpeciesFluxes(
+  const Vector<Array<MultiFab*, AMREX_SPACEDIM>>& a_fluxes,
+  std::unique_ptr<AdvanceDiffData>& diffData)
+{
+  BL_PROFILE("PeleLMeX::correctSpeciesFluxes()");
+
+  // Add lagged Wbar term
+  // Computed in computeDifferentialDiffusionTerms at t^{n} if first SDC
+  // iteration, t^{np1,k} otherwise
+  // Folded into the flux correction pass with the fused kernel
+  if (m_use_wbar != 0 && m_fusedSpeciesFluxCorr == 0) {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+
+      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+          const Box& ebx = mfi.nodaltilebox(idim);
+          auto const& flux_spec = a_fluxes[lev][idim]->array(mfi);
+          auto const& flux_wbar =
+            diffData->wbar_fluxes[lev][idim].const_array(mfi);
+          amrex::ParallelFor(
+            ebx, NUM_SPECIES,
+            [flux_spec,
+             flux_wbar] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+              flux_spec(i, j, k, n) += flux_wbar(i, j, k, n);
+            });
+        }
+      }
+    }
+  }
+  if (m_use_soret != 0 && m_fusedSpeciesFluxCorr == 0) {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+          const Box& ebx = mfi.nodaltilebox(idim);
+          auto const& flux_spec = a_fluxes[lev][idim]->array(mfi);
+          auto const& flux_soret =
+            diffData->soret_fluxes[lev][idim].const_array(mfi);
+          amrex::ParallelFor(
+            ebx, NUM_SPECIES,
+            [flux_spec,
+             flux_soret] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+              flux_spec(i, j, k, n) += flux_soret(i, j, k, n);
+            });
+        }
+      }
+    }
+  }
+
+  if (m_fusedSpeciesFluxCorr != 0) {
+    // Add the lagged Wbar and Soret fluxes and adjust the species fluxes in a
+    // single pass. The finest level diffusion term is computed in the same
+    // box loop, the coarser ones need the averaged down fluxes.
+    auto spec = getSpeciesVect(AmrNewTime);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      MultiFab* divergence = (lev == finest_level && !geom[lev].IsRZ())
+                               ? &diffData->Dhat[lev]
+                               : nullptr;
+      correctSpeciesFluxesFused(
+        lev, a_fluxes[lev], *spec[lev], diffData, divergence);
+    }
+
+    // Average down fluxes^{np1,kp1}
+    getDiffusionOp()->avgDownFluxes(a_fluxes, 0, NUM_SPECIES);
+
+    // Compute diffusion term D^{np1,kp1} (or Dhat) on the remaining levels
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      if (lev < finest_level || geom[lev].IsRZ()) {
+        intFluxDivergenceLevel(
+          lev, diffData->Dhat[lev], 0, a_fluxes[lev], 0, NUM_SPECIES, -1.0);
+      }
+    }
+  } else {
+    // Adjust species diffusion fluxes to ensure their sum is zero
+    adjustSpeciesFluxes(
+      a_fluxes, GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)));
+
+    // Average down fluxes^{np1,kp1}
+    getDiffusionOp()->avgDownFluxes(a_fluxes, 0, NUM_SPECIES);
+
+    // Compute diffusion term D^{np1,kp1} (or Dhat)
+    fluxDivergence(
+      GetVecOfPtrs(diffData->Dhat), 0, a_fluxes, 0, NUM_SPECIES, 1, -1.0);
+  }
+}
+
+Real
+PeleLM::updateMultiComponentFluxes(
+  std::unique_ptr<AdvanceAdvData>& advData,
+  std::unique_ptr<AdvanceDiffData>& diffData)
+{
+  BL_PROFILE("PeleLMeX::updateMultiComponentFluxes()");
+
+  //------------------------------------------------------------------------
+  // Fickian and non-Fickian species fluxes at the updated species
+  int nGrow = 0; // No need for ghost face on fluxes
+  Vector<Array<MultiFab, AMREX_SPACEDIM>> spFluxes(finest_level + 1);
+  Vector<Array<MultiFab, AMREX_SPACEDIM>> mcFluxes(finest_level + 1);
+  Vector<MultiFab> Dmc(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    const auto& ba = grids[lev];
+    const auto& factory = Factory(lev);
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      spFluxes[lev][idim] = m_mfPool.acquire(
+        lev, amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
+        NUM_SPECIES, nGrow, factory);
+      mcFluxes[lev][idim] = m_mfPool.acquire(
+        lev, amrex::convert(ba, IntVect::TheDimensionVector(idim)), dmap[lev],
+        NUM_SPECIES, nGrow, factory);
+    }
+    Dmc[lev] = m_mfPool.acquire(lev, ba, dmap[lev], NUM_SPECIES, 0, factory);
+  }
+
+  auto bcRecSpec = fetchBCRecArray(FIRSTSPEC, NUM_SPECIES);
+  int do_avgDown = 0;
+  getMCDiffusionOp(NUM_SPECIES)
+    ->computeDiffFluxes(
+      GetVecOfArrOfPtrs(spFluxes), 0,
+      GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)), 0,
+      GetVecOfConstPtrs(getDensityVect(AmrNewTime)),
+      GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)), 0, bcRecSpec,
+      NUM_SPECIES, do_avgDown);
+  addMultiComponentTerm(
+    GetVecOfArrOfPtrs(spFluxes), GetVecOfArrOfPtrs(mcFluxes),
+    GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)),
+    GetVecOfConstPtrs(getDensityVect(AmrNewTime)),
+    GetVecOfConstPtrs(getTempVect(AmrNewTime)),
+    GetVecOfConstPtrs(getDiffusivityVect(AmrNewTime)));
+  getDiffusionOp()->avgDownFluxes(GetVecOfArrOfPtrs(mcFluxes), 0, NUM_SPECIES);
+
+  //------------------------------------------------------------------------
+  // Divergence of the non-Fickian fluxes
+  int intensiveFluxes = 1;
+#ifdef AMREX_USE_EB
+  auto bcRecSpec_d = convertToDeviceVector(bcRecSpec);
+  fluxDivergenceRD(
+    GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)), 0, GetVecOfPtrs(Dmc), 0,
+    GetVecOfArrOfPtrs(mcFluxes), 0, {}, 0, NUM_SPECIES, intensiveFluxes,
+    bcRecSpec_d.dataPtr(), -1.0, m_dt);
+#else
+  fluxDivergence(
+    GetVecOfPtrs(Dmc), 0, GetVecOfArrOfPtrs(mcFluxes), 0, NUM_SPECIES,
+    intensiveFluxes, -1.0);
+#endif
+
+  //------------------------------------------------------------------------
+  // Swap the lagged fluxes and their divergence in the species solve RHS,
+  // the species update removing dt * Dwbar again
+  Real mcNorm = 0.0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+#ifdef AMREX_USE_EB
+    EB_set_covered(Dmc[lev], 0.0);
+#endif
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+    MultiFab dY(grids[lev], dmap[lev], 1, 0, MFInfo(), Factory(lev));
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(dY, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& fY = advData->Forcing[lev].array(mfi, 0);
+      auto const& dwbar = diffData->Dwbar[lev].array(mfi);
+      auto const& dmc = Dmc[lev].const_array(mfi);
+      auto const& rho = ldata_p->state.const_array(mfi, DENSITY);
+      auto const& dY_arr = dY.array(mfi);
+      amrex::ParallelFor(
+        bx, [fY, dwbar, dmc, rho, dY_arr,
+             dt = m_dt] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          amrex::Real dYmax = 0.0;
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            const amrex::Real delta =
+              dt * (dmc(i, j, k, n) - dwbar(i, j, k, n));
+            fY(i, j, k, n) += delta;
+            dwbar(i, j, k, n) = dmc(i, j, k, n);
+            dYmax = amrex::max(dYmax, std::abs(delta));
+          }
+          dY_arr(i, j, k) = dYmax / rho(i, j, k);
+        });
+    }
+    mcNorm = std::max(mcNorm, dY.norm0(0, 0, false, true));
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      MultiFab::Copy(
+        diffData->wbar_fluxes[lev][idim], mcFluxes[lev][idim], 0, 0,
+        NUM_SPECIES, 0);
+    }
+  }
+
+  m_mfPool.release(spFluxes);
+  m_mfPool.release(mcFluxes);
+  m_mfPool.release(Dmc);
+
+  return mcNorm;
 }
 
 void
@@ -1255,6 +1801,7 @@ PeleLM::deltaTIter_prepare(
 
       // T save
       auto const& tsave = a_Tsave[lev]->array(mfi);
+      const bool thermoSoA = useThermoSoA();
       amrex::ParallelFor(
         bx, [=, dt = m_dt] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
           // Assemble deltaT RHS
@@ -1263,12 +1810,17 @@ PeleLM::deltaTIter_prepare(
                   fourier(i, j, k) + diffDiff(i, j, k));
 
           // Get \rho * Cp_{mix}
-          getCpmixGivenRYT(i, j, k, rho, rhoY, T, rhocp);
-          rhocp(i, j, k) *= rho(i, j, k);
+          if (!thermoSoA) {
+            getCpmixGivenRYT(i, j, k, rho, rhoY, T, rhocp);
+            rhocp(i, j, k) *= rho(i, j, k);
+          }
 
           // Save T
           tsave(i, j, k) = T(i, j, k);
         });
+      if (thermoSoA) {
+        m_thermoSoA.getRhoCpmix(bx, rhoY, T, rhocp);
+      }
     }
 
     // Set T^{np1} to zero
@@ -1371,6 +1923,18 @@ PeleLM::deltaTIter_update(
   // Recompute RhoH
   for (int lev = 0; lev <= finest_level; ++lev) {
     auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+    if (useThermoSoA()) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(ldata_p->state, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        m_thermoSoA.getRHmix(
+          mfi.tilebox(), ldata_p->state.const_array(mfi, FIRSTSPEC),
+          ldata_p->state.const_array(mfi, TEMP),
+          ldata_p->state.array(mfi, RHOH));
+      }
+      continue;
+    }
     auto const& sma = ldata_p->state.arrays();
     amrex::ParallelFor(
       ldata_p->state,
@@ -1385,6 +1949,130 @@ PeleLM::deltaTIter_update(
   Gpu::streamSynchronize();
 }
 
+Real
+PeleLM::deltaTIter_anderson(
+  int a_dtiter,
+  const Vector<MultiFab const*>& a_Tsave,
+  Vector<Vector<MultiFab>>& a_Fhist,
+  Vector<Vector<MultiFab>>& a_Ghist)
+{
+  BL_PROFILE("PeleLMeX::deltaTIter_anderson()");
+
+  // Store the increment f_k = G(T_k) - T_k and the fixed point map
+  // g_k = G(T_k) of the current iterate in the history ring buffers
+  const int nhist = static_cast<int>(a_Fhist.size());
+  const int slot = a_dtiter % nhist;
+  Real rawNorm = 0.0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+    MultiFab::Copy(a_Fhist[slot][lev], ldata_p->state, TEMP, 0, 1, 0);
+    MultiFab::LinComb(
+      a_Ghist[slot][lev], 1.0, *a_Tsave[lev], 0, 1.0, a_Fhist[slot][lev], 0, 0,
+      1, 0);
+    rawNorm = std::max(rawNorm, a_Fhist[slot][lev].norm0(0, 0, false, true));
+  }
+
+  const int mk = std::min(nhist - 1, a_dtiter);
+  if (mk == 0) {
+    return rawNorm;
+  }
+
+  // Differences of successive increments
+  auto histSlot = [=](int j) { return (a_dtiter - mk + j) % nhist; };
+  Vector<Vector<MultiFab>> dF(mk);
+  for (int j = 0; j < mk; ++j) {
+    dF[j].resize(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      dF[j][lev] =
+        m_mfPool.acquire(lev, grids[lev], dmap[lev], 1, 0, Factory(lev));
+      MultiFab::LinComb(
+        dF[j][lev], 1.0, a_Fhist[histSlot(j + 1)][lev], 0, -1.0,
+        a_Fhist[histSlot(j)][lev], 0, 0, 1, 0);
+    }
+  }
+
+  // Least squares min |f_k - dF gamma|: normal equations assembled with a
+  // single reduction, summing over the levels
+  const int nrow = mk * (mk + 1);
+  Vector<Real> dots(nrow, 0.0);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    for (int i = 0; i < mk; ++i) {
+      for (int j = 0; j <= i; ++j) {
+        dots[i * (mk + 1) + j] +=
+          MultiFab::Dot(dF[i][lev], 0, dF[j][lev], 0, 1, 0, true);
+      }
+      dots[i * (mk + 1) + mk] +=
+        MultiFab::Dot(dF[i][lev], 0, a_Fhist[slot][lev], 0, 1, 0, true);
+    }
+  }
+  ParallelAllReduce::Sum(dots.data(), nrow, ParallelContext::CommunicatorSub());
+  for (int i = 0; i < mk; ++i) {
+    for (int j = i + 1; j < mk; ++j) {
+      dots[i * (mk + 1) + j] = dots[j * (mk + 1) + i];
+    }
+  }
+
+  // Gaussian elimination with partial pivoting, slightly regularized
+  Real trace = 0.0;
+  for (int i = 0; i < mk; ++i) {
+    trace += dots[i * (mk + 1) + i];
+  }
+  for (int i = 0; i < mk; ++i) {
+    dots[i * (mk + 1) + i] += 1.0e-12 * trace;
+  }
+  Vector<Real> gamma(mk, 0.0);
+  bool solved = trace > 0.0;
+  for (int c = 0; c < mk && solved; ++c) {
+    int piv = c;
+    for (int r = c + 1; r < mk; ++r) {
+      if (
+        std::abs(dots[r * (mk + 1) + c]) > std::abs(dots[piv * (mk + 1) + c])) {
+        piv = r;
+      }
+    }
+    if (dots[piv * (mk + 1) + c] == 0.0) {
+      solved = false;
+      break;
+    }
+    for (int n = 0; n <= mk; ++n) {
+      std::swap(dots[c * (mk + 1) + n], dots[piv * (mk + 1) + n]);
+    }
+    for (int r = c + 1; r < mk; ++r) {
+      const Real fac = dots[r * (mk + 1) + c] / dots[c * (mk + 1) + c];
+      for (int n = c; n <= mk; ++n) {
+        dots[r * (mk + 1) + n] -= fac * dots[c * (mk + 1) + n];
+      }
+    }
+  }
+  for (int r = mk - 1; r >= 0 && solved; --r) {
+    Real sum = dots[r * (mk + 1) + mk];
+    for (int n = r + 1; n < mk; ++n) {
+      sum -= dots[r * (mk + 1) + n] * gamma[n];
+    }
+    gamma[r] = sum / dots[r * (mk + 1) + r];
+  }
+
+  // Accelerated increment: T_{k+1} - T_k = f_k - sum_j gamma_j dG_j
+  if (solved) {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+      for (int j = 0; j < mk; ++j) {
+        MultiFab::Saxpy(
+          ldata_p->state, -gamma[j], a_Ghist[histSlot(j + 1)][lev], 0, TEMP, 1,
+          0);
+        MultiFab::Saxpy(
+          ldata_p->state, gamma[j], a_Ghist[histSlot(j)][lev], 0, TEMP, 1, 0);
+      }
+    }
+  }
+
+  for (auto& dFj : dF) {
+    m_mfPool.release(dFj);
+  }
+
+  return rawNorm;
+}
+
 void
 PeleLM::getScalarDiffForce(
   std::unique_ptr<AdvanceAdvData>& advData,
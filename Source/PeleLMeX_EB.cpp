@@ -1,4 +1,5 @@
 #include <PeleLMeX.H>
+#include <PeleLMeX_K.H>
 #include <PeleLMeX_Utils.H>
 #include <pelelmex_prob.H>
 #include <PeleLMeX_EBUserDefined.H>
@@ -7,6 +8,7 @@
 #include <AMReX_EB2.H>
 #include <AMReX_EB2_IF.H>
 #include <AMReX_EB_Redistribution.H>
+#include <AMReX_EB_utils.H>
 #include <AMReX_EBMFInterpolater.H>
 
 using namespace amrex;
@@ -67,7 +69,7 @@ PeleLM::redistributeAofS(
   int state_comp,
   int ncomp,
   const BCRec* d_bc,
-  const Geometry& a_geom) const
+  const Geometry& a_geom)
 {
   BL_PROFILE("PeleLMeX::redistributeAofS()");
   AMREX_ASSERT(a_tmpDiv.nComp() >= div_comp + ncomp);
@@ -82,6 +84,7 @@ PeleLM::redistributeAofS(
 #endif
   for (MFIter mfi(a_tmpDiv, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
 
+    const Real t0 = m_costMeasure.start();
     Box const& bx = mfi.tilebox();
     auto const& flagfab = ebfact.getMultiEBCellFlagFab()[mfi];
     auto const& flag = flagfab.const_array();
@@ -133,6 +136,7 @@ PeleLM::redistributeAofS(
           });
       }
     }
+    m_costMeasure.stop(a_lev, mfi, t0, CostMeasure::Redistribution);
   }
 }
 
@@ -196,7 +200,7 @@ PeleLM::redistributeDiff(
   int state_comp,
   int ncomp,
   const BCRec* d_bc,
-  const Geometry& a_geom) const
+  const Geometry& a_geom)
 {
   BL_PROFILE("PeleLMeX::redistributeDiff()");
   AMREX_ASSERT(a_tmpDiv.nComp() >= div_comp + ncomp);
@@ -211,6 +215,7 @@ PeleLM::redistributeDiff(
 #endif
   for (MFIter mfi(a_tmpDiv, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
 
+    const Real t0 = m_costMeasure.start();
     Box const& bx = mfi.tilebox();
     auto const& flagfab = ebfact.getMultiEBCellFlagFab()[mfi];
     auto const& flag = flagfab.const_array();
@@ -262,6 +267,7 @@ PeleLM::redistributeDiff(
           });
       }
     }
+    m_costMeasure.stop(a_lev, mfi, t0, CostMeasure::Redistribution);
   }
 }
 
@@ -453,6 +459,143 @@ PeleLM::getEBDistance(int a_lev, MultiFab& a_signDistLev)
   }
 }
 
+void
+PeleLM::getEBDistanceSweep(int a_lev, Real a_maxDist, MultiFab& a_signDistLev)
+{
+  BL_PROFILE("PeleLMeX::getEBDistanceSweep()");
+
+  // Cached distance of the level grids, valid if computed with the same
+  // maximum distance. The distance only depends on the geometry, such that
+  // boxes covered by the cached grids can be reused when the grids change
+  auto& cache = m_signedDistLev[a_lev];
+  const bool useCache = cache && m_signedDistLevMax[a_lev] == a_maxDist;
+  if (
+    useCache && cache->boxArray() == grids[a_lev] &&
+    cache->DistributionMap() == dmap[a_lev]) {
+    MultiFab::Copy(a_signDistLev, *cache, 0, 0, 1, 0);
+    return;
+  }
+
+  Vector<int> sweepBox(grids[a_lev].size(), 1);
+  BoxList seedBL;
+  Vector<int> seedPmap;
+  for (int i = 0; i < grids[a_lev].size(); ++i) {
+    if (useCache && cache->boxArray().contains(grids[a_lev][i])) {
+      sweepBox[i] = 0;
+    } else {
+      seedBL.push_back(grids[a_lev][i]);
+      seedPmap.push_back(dmap[a_lev][i]);
+    }
+  }
+
+  if (m_verbose > 2) {
+    Print() << " Computing EB distance on " << seedPmap.size() << " of "
+            << grids[a_lev].size() << " boxes of level " << a_lev << "\n";
+  }
+
+  const int nGrowSweep = 1;
+  auto newDist =
+    std::make_unique<MultiFab>(grids[a_lev], dmap[a_lev], 1, nGrowSweep);
+  newDist->setVal(a_maxDist);
+
+  if (!seedPmap.empty()) {
+    // Seed with the distance to the EB facets, only accurate close to the
+    // EB. A factory is needed on the seeded boxes only.
+    const bool allBoxes =
+      static_cast<Long>(seedPmap.size()) == grids[a_lev].size();
+    BoxArray seedBA(std::move(seedBL));
+    DistributionMapping seedDM(std::move(seedPmap));
+    std::unique_ptr<EBFArrayBoxFactory> seedFact;
+    if (!allBoxes) {
+      seedFact = makeEBFabFactory(
+        geom[a_lev], seedBA, seedDM, {6, 6, 6}, EBSupport::full);
+    }
+    const auto& fact = allBoxes ? EBFactory(a_lev) : *seedFact;
+    MultiFab sdNodal(
+      convert(seedBA, IntVect::TheUnitVector()), seedDM, 1, 0, MFInfo(), fact);
+    FillSignedDistance(sdNodal, true);
+    const Real farDist = sdNodal.max(0) - 1e-12;
+
+    MultiFab sdCC(seedBA, seedDM, 1, 0);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sdCC, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& sd_cc = sdCC.array(mfi);
+      auto const& sd_nd = sdNodal.const_array(mfi);
+      amrex::ParallelFor(
+        bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          // Cells with a node out of reach are left to the sweeps
+          bool farCell = false;
+          amrex::Real avg = 0.0;
+          for (int n = 0; n < AMREX_D_TERM(2, *2, *2); ++n) {
+            const amrex::Real val = sd_nd(
+              i + (n & 1), j + AMREX_D_PICK(0, (n >> 1) & 1, (n >> 1) & 1),
+              k + AMREX_D_PICK(0, 0, (n >> 2) & 1));
+            farCell = farCell || (val >= farDist);
+            avg += val;
+          }
+          avg *= AMREX_D_PICK(0.5, 0.25, 0.125);
+          sd_cc(i, j, k) = farCell ? a_maxDist : amrex::min(avg, a_maxDist);
+        });
+    }
+    newDist->ParallelCopy(sdCC, 0, 0, 1);
+  }
+  if (useCache) {
+    newDist->ParallelCopy(*cache, 0, 0, 1);
+  }
+
+  // Propagate the distance away from the EB up to a_maxDist. The updates
+  // are done in place, and only decrease the distance: convergence is
+  // reached after at most a_maxDist/dx iterations, usually much less on
+  // CPUs where the in-place loop order propagates the distance faster.
+  const auto dx = geom[a_lev].CellSizeArray();
+  const Real dxMin = amrex::min(AMREX_D_DECL(dx[0], dx[1], dx[2]));
+  const int maxIter = static_cast<int>(std::ceil(a_maxDist / dxMin)) + 2;
+  int iter = 0;
+  for (; iter < maxIter; ++iter) {
+    newDist->FillBoundary(geom[a_lev].periodicity());
+    ReduceOps<ReduceOpMax> reduce_op;
+    ReduceData<Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+    for (MFIter mfi(*newDist); mfi.isValid(); ++mfi) {
+      if (sweepBox[mfi.index()] == 0) {
+        continue;
+      }
+      const Box& bx = mfi.validbox();
+      auto const& sd = newDist->array(mfi);
+      reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept -> ReduceTuple {
+          const amrex::Real old = sd(i, j, k);
+          if (old <= 0.0) {
+            return {0.0};
+          }
+          const amrex::Real u = eikonalUpdate(i, j, k, sd, dx);
+          if (u < old) {
+            sd(i, j, k) = u;
+            return {old - u};
+          }
+          return {0.0};
+        });
+    }
+    Real change = amrex::get<0>(reduce_data.value(reduce_op));
+    ParallelDescriptor::ReduceRealMax(change);
+    if (change < 1.0e-6 * dxMin) {
+      break;
+    }
+  }
+
+  if (m_verbose > 2) {
+    Print() << " EB distance sweeps on level " << a_lev << ": " << iter << "\n";
+  }
+
+  MultiFab::Copy(a_signDistLev, *newDist, 0, 0, 1, 0);
+  cache = std::move(newDist);
+  m_signedDistLevMax[a_lev] = a_maxDist;
+}
+
 void
 PeleLM::getEBState(
   int a_lev, const Real& a_time, MultiFab& a_EBstate, int stateComp, int nComp)
@@ -536,6 +679,7 @@ PeleLM::getEBDiff(
   Array<const MultiCutFab*, AMREX_SPACEDIM> faceCentroid = ebfact.getFaceCent();
 
   // Get diffusivity cell-centered
+  ensureDiffusivity(a_time);
   auto* ldata_p = getLevelDataPtr(a_lev, a_time);
 
   MFItInfo mfi_info;
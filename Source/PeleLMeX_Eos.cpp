@@ -51,10 +51,27 @@ PeleLM::calcDivU(
 
   // If requested, compute diffusion terms
   // otherwise assumes it has already been computed and stored in the proper
-  // container of diffData
+  // container of diffData. With fused_divu, only the diffusion fluxes are
+  // computed here and diverged in the divU assembly, diffData is left
+  // untouched.
+  const bool fusedDivU =
+    (computeDiff != 0) && (m_fusedDivU != 0) && !geom[0].IsRZ();
+  Vector<Array<MultiFab, AMREX_SPACEDIM>> fluxes;
   if (computeDiff != 0) {
     calcDiffusivity(a_time);
-    computeDifferentialDiffusionTerms(a_time, diffData, is_init);
+    if (fusedDivU) {
+      fluxes.resize(finest_level + 1);
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+          fluxes[lev][idim] = m_mfPool.acquire(
+            lev, amrex::convert(grids[lev], IntVect::TheDimensionVector(idim)),
+            dmap[lev], NUM_SPECIES + 2, 0, Factory(lev));
+        }
+      }
+      computeDivUDiffusionFluxes(a_time, GetVecOfArrOfPtrs(fluxes));
+    } else {
+      computeDifferentialDiffusionTerms(a_time, diffData, is_init);
+    }
   }
 
   // Assemble divU on each level
@@ -63,6 +80,7 @@ PeleLM::calcDivU(
     auto* ldata_p = getLevelDataPtr(lev, a_time);
 
     MultiFab RhoYdot;
+    const MultiFab* RhoYdot_p = &RhoYdot;
     if ((m_do_react != 0) && (m_skipInstantRR == 0)) {
       if (is_init != 0) { // Either pre-divU, divU or press initial iterations
         if (m_dt > 0.0) { // divU ite   -> use I_R
@@ -74,12 +92,19 @@ PeleLM::calcDivU(
           RhoYdot.setVal(0.0);
         }
       } else { // Regular    -> use instantaneous RR
-        RhoYdot.define(grids[lev], dmap[lev], nCompIR(), 0);
+        auto* ldataR_p = getLevelDataReactPtr(lev);
+        if (a_time == AmrNewTime && ldataR_p->instRRCached != 0) {
+          // Cached at the end of the chemistry integration
+          RhoYdot_p = &(ldataR_p->I_R_inst);
+          ldataR_p->instRRCached = 0;
+        } else {
+          RhoYdot.define(grids[lev], dmap[lev], nCompIR(), 0);
 #ifdef PELE_USE_EFIELD
-        computeInstantaneousReactionRateEF(lev, a_time, &RhoYdot);
+          computeInstantaneousReactionRateEF(lev, a_time, &RhoYdot);
 #else
-        computeInstantaneousReactionRate(lev, a_time, &RhoYdot);
+          computeInstantaneousReactionRate(lev, a_time, &RhoYdot);
 #endif
+        }
       }
     }
 
@@ -88,6 +113,7 @@ PeleLM::calcDivU(
     // Get EBFact
     const auto& ebfact = EBFactory(lev);
 #endif
+    const auto dxinv = geom[lev].InvCellSizeArray();
 
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -115,7 +141,7 @@ PeleLM::calcDivU(
           : diffData->Dnp1[lev].const_array(mfi, NUM_SPECIES + 1);
       auto const& r =
         ((m_do_react != 0) && (m_skipInstantRR == 0))
-          ? RhoYdot.const_array(mfi)
+          ? RhoYdot_p->const_array(mfi)
           : ldata_p->state.const_array(mfi, FIRSTSPEC); // Dummy unused Array4
       auto const& extRhoY = m_extSource[lev]->const_array(mfi, FIRSTSPEC);
       auto const& extRhoH = m_extSource[lev]->const_array(mfi, RHOH);
@@ -143,7 +169,21 @@ PeleLM::calcDivU(
           });
       } else
 #endif
-      {
+        if (fusedDivU) {
+        // Diverge the fluxes while assembling divU, no round trip of the
+        // diffusion terms through diffData
+        AMREX_D_TERM(auto const& fluxX = fluxes[lev][0].const_array(mfi);
+                     , auto const& fluxY = fluxes[lev][1].const_array(mfi);
+                     , auto const& fluxZ = fluxes[lev][2].const_array(mfi););
+        amrex::ParallelFor(
+          bx, [rhoY, T, AMREX_D_DECL(fluxX, fluxY, fluxZ), dxinv, r, extRhoY,
+               extRhoH, divu,
+               use_react] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            compute_divu_fused(
+              i, j, k, rhoY, T, AMREX_D_DECL(fluxX, fluxY, fluxZ), dxinv, r,
+              extRhoY, extRhoH, divu, use_react);
+          });
+      } else {
         amrex::ParallelFor(
           bx, [rhoY, T, SpecD, Fourier, DiffDiff, r, extRhoY, extRhoH, divu,
                use_react] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
@@ -154,6 +194,9 @@ PeleLM::calcDivU(
       }
     }
   }
+  if (fusedDivU) {
+    m_mfPool.release(fluxes);
+  }
 
   // Average down divU
   if (do_avgDown != 0) {
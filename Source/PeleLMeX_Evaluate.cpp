@@ -1,4 +1,5 @@
 #include <PeleLMeX.H>
+#include <PeleLMeX_K.H>
 #include <AMReX_PlotFileUtil.H>
 #include <memory>
 
@@ -234,6 +235,341 @@ PeleLM::MLevaluate(
     } else {
       nComp = NUM_SPECIES + 2;
     }
+  } else if (a_var == "transportTable") {
+    // Relative difference between the tabulated and the full transport
+    // coefficients, timing both evaluations
+    if (!m_transportTable.isDefined()) {
+      amrex::Abort("transportTable evaluation requires peleLM.transport_table");
+    }
+    Vector<MultiFab> fullCoeffs(finest_level + 1);
+    const int useTableSave = m_useTransportTable;
+    const Real laggedTolSave = m_laggedTransportTol;
+    m_laggedTransportTol = 0.0;
+    Real times[2] = {0.0};
+    for (int pass = 0; pass < 2; ++pass) {
+      m_useTransportTable = pass;
+      Real start = ParallelDescriptor::second();
+      calcViscosity(AmrNewTime);
+      calcDiffusivity(AmrNewTime);
+      times[pass] = ParallelDescriptor::second() - start;
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+        if (pass == 0) {
+          fullCoeffs[lev].define(grids[lev], dmap[lev], NUM_SPECIES + 2, 0);
+          MultiFab::Copy(
+            fullCoeffs[lev], ldata_p->diff_cc, 0, 0, NUM_SPECIES + 1, 0);
+          MultiFab::Copy(
+            fullCoeffs[lev], ldata_p->visc_cc, 0, NUM_SPECIES + 1, 1, 0);
+        } else {
+          auto const& full = fullCoeffs[lev].const_arrays();
+          auto const& diff = ldata_p->diff_cc.const_arrays();
+          auto const& visc = ldata_p->visc_cc.const_arrays();
+          auto const& err = a_MFVec[lev]->arrays();
+          amrex::ParallelFor(
+            fullCoeffs[lev],
+            [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+              for (int n = 0; n <= NUM_SPECIES + 1; n++) {
+                const Real tab = (n <= NUM_SPECIES) ? diff[box_no](i, j, k, n)
+                                                    : visc[box_no](i, j, k);
+                const Real ref = full[box_no](i, j, k, n);
+                err[box_no](i, j, k, a_comp + n) =
+                  std::abs(tab - ref) / amrex::max(std::abs(ref), 1.0e-30);
+              }
+            });
+        }
+      }
+    }
+    Gpu::streamSynchronize();
+    m_useTransportTable = useTableSave;
+    m_laggedTransportTol = laggedTolSave;
+    ParallelDescriptor::ReduceRealMax(
+      times, 2, ParallelDescriptor::IOProcessorNumber());
+    Print() << "    Transport evaluation: full " << times[0] << " s, table "
+            << times[1] << " s\n";
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      Real errRhoD = 0.0;
+      for (int n = 0; n < NUM_SPECIES; n++) {
+        errRhoD = std::max(errRhoD, a_MFVec[lev]->max(a_comp + n));
+      }
+      Print() << "    Level " << lev << " max relative error: rhoD " << errRhoD
+              << ", lambda " << a_MFVec[lev]->max(a_comp + NUM_SPECIES)
+              << ", mu " << a_MFVec[lev]->max(a_comp + NUM_SPECIES + 1) << "\n";
+    }
+    nComp = NUM_SPECIES + 2;
+  } else if (a_var == "thermoSoA") {
+    // Relative difference between the strip and the per-cell evaluations of
+    // rho * h_mix and rho * cp_mix, timing both over a number of repetitions
+    if (!m_thermoSoA.isDefined()) {
+      amrex::Abort("thermoSoA evaluation requires peleLM.thermo_soa");
+    }
+    constexpr int nrep = 10;
+    Real times[2] = {0.0};
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+      MultiFab ref(grids[lev], dmap[lev], 2, 0);
+      MultiFab soa(grids[lev], dmap[lev], 2, 0);
+      for (int pass = 0; pass < 2; ++pass) {
+        MultiFab& res = (pass == 0) ? ref : soa;
+        Real start = ParallelDescriptor::second();
+        for (int r = 0; r < nrep; ++r) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+          for (MFIter mfi(res, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            const Box& bx = mfi.tilebox();
+            auto const& rho = ldata_p->state.const_array(mfi, DENSITY);
+            auto const& rhoY = ldata_p->state.const_array(mfi, FIRSTSPEC);
+            auto const& T = ldata_p->state.const_array(mfi, TEMP);
+            auto const& rhoH = res.array(mfi, 0);
+            auto const& rhoCp = res.array(mfi, 1);
+            if (pass == 0) {
+              amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                  getRHmixGivenTY(i, j, k, rho, rhoY, T, rhoH);
+                  getCpmixGivenRYT(i, j, k, rho, rhoY, T, rhoCp);
+                  rhoCp(i, j, k) *= rho(i, j, k);
+                });
+            } else {
+              m_thermoSoA.getRHmix(bx, rhoY, T, rhoH);
+              m_thermoSoA.getRhoCpmix(bx, rhoY, T, rhoCp);
+            }
+          }
+        }
+        Gpu::streamSynchronize();
+        times[pass] += ParallelDescriptor::second() - start;
+      }
+      auto const& refa = ref.const_arrays();
+      auto const& soaa = soa.const_arrays();
+      auto const& err = a_MFVec[lev]->arrays();
+      amrex::ParallelFor(
+        ref, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+          for (int n = 0; n < 2; n++) {
+            const Real r = refa[box_no](i, j, k, n);
+            err[box_no](i, j, k, a_comp + n) =
+              std::abs(soaa[box_no](i, j, k, n) - r) /
+              amrex::max(std::abs(r), 1.0e-30);
+          }
+        });
+    }
+    Gpu::streamSynchronize();
+    ParallelDescriptor::ReduceRealMax(
+      times, 2, ParallelDescriptor::IOProcessorNumber());
+    Print() << "    Thermo evaluation (" << nrep << " repetitions): per-cell "
+            << times[0] << " s, strips " << times[1] << " s\n";
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      Print() << "    Level " << lev << " max relative error: RhoH "
+              << a_MFVec[lev]->max(a_comp) << ", RhoCp "
+              << a_MFVec[lev]->max(a_comp + 1) << "\n";
+    }
+    nComp = 2;
+  } else if (a_var == "lowMemTransport") {
+    // Memory saved by sharing the diffusivity container between the old and
+    // new states, and time of an on-demand recomputation. The relative
+    // difference with the stored coefficients checks the recomputation.
+    if (m_lowMemTransport == 0) {
+      amrex::Abort(
+        "lowMemTransport evaluation requires peleLM.low_memory_transport");
+    }
+    copyStateNewToOld(1);
+    calcDiffusivity(AmrNewTime);
+    const int ncompDiff = m_leveldata_new[0]->diff_cc.nComp();
+    Vector<MultiFab> stored(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      stored[lev].define(grids[lev], dmap[lev], ncompDiff, 0);
+      MultiFab::Copy(
+        stored[lev], m_leveldata_new[lev]->diff_cc, 0, 0, ncompDiff, 0);
+    }
+    // Each request of the other time level recomputes the coefficients
+    constexpr int nrep = 10;
+    Real start = ParallelDescriptor::second();
+    for (int r = 0; r < nrep; ++r) {
+      ensureDiffusivity(AmrOldTime);
+      ensureDiffusivity(AmrNewTime);
+    }
+    Real evalTime = (ParallelDescriptor::second() - start) / (2 * nrep);
+    ParallelDescriptor::ReduceRealMax(
+      evalTime, ParallelDescriptor::IOProcessorNumber());
+    Print() << "    On-demand diffusivity evaluation: " << evalTime << " s\n";
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      auto const& ref = stored[lev].const_arrays();
+      auto const& diff = m_leveldata_new[lev]->diff_cc.const_arrays();
+      auto const& err = a_MFVec[lev]->arrays();
+      amrex::ParallelFor(
+        stored[lev],
+        [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+          Real errMax = 0.0;
+          for (int n = 0; n < ncompDiff; n++) {
+            const Real r = ref[box_no](i, j, k, n);
+            errMax = amrex::max(
+              errMax, std::abs(diff[box_no](i, j, k, n) - r) /
+                        amrex::max(std::abs(r), 1.0e-30));
+          }
+          err[box_no](i, j, k, a_comp) = errMax;
+        });
+      Gpu::streamSynchronize();
+      BoxArray ba = grids[lev];
+      ba.grow(m_leveldata_new[lev]->diff_cc.nGrow());
+      const Real savedMB = static_cast<Real>(ncompDiff * ba.numPts()) *
+                           sizeof(Real) / (1024.0 * 1024.0);
+      Print() << "    Level " << lev << " shared diffusivity saves " << savedMB
+              << " MB, max relative difference " << a_MFVec[lev]->max(a_comp)
+              << "\n";
+    }
+    nComp = 1;
+  } else if (a_var == "speciesFluxCorr") {
+    // Time the species flux correction with the default and fused kernels on
+    // the same fluxes. The difference of the species diffusion terms is
+    // scaled by the max of each default term on the level.
+    if (m_fusedSpeciesFluxCorr == 0) {
+      amrex::Abort("speciesFluxCorr evaluation requires "
+                   "peleLM.fused_species_flux_correction");
+    }
+    std::unique_ptr<AdvanceDiffData> diffData;
+    diffData = std::make_unique<AdvanceDiffData>(
+      finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar,
+      m_use_soret);
+    calcDiffusivity(AmrNewTime);
+    fillPatchSpecies(AmrNewTime);
+    computeDifferentialDiffusionTerms(AmrNewTime, diffData);
+    Vector<Array<MultiFab, AMREX_SPACEDIM>> fluxes0(finest_level + 1);
+    Vector<Array<MultiFab, AMREX_SPACEDIM>> fluxes(finest_level + 1);
+    Long faceBytes = 0;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+        const BoxArray ba =
+          amrex::convert(grids[lev], IntVect::TheDimensionVector(idim));
+        fluxes0[lev][idim].define(
+          ba, dmap[lev], NUM_SPECIES + 2, 0, MFInfo(), Factory(lev));
+        fluxes[lev][idim].define(
+          ba, dmap[lev], NUM_SPECIES + 2, 0, MFInfo(), Factory(lev));
+        faceBytes += ba.numPts() * NUM_SPECIES * sizeof(Real);
+      }
+    }
+    computeDifferentialDiffusionFluxes(
+      AmrNewTime, GetVecOfArrOfPtrs(fluxes0), {}, {}, {});
+
+    constexpr int nrep = 10;
+    const int fusedSave = m_fusedSpeciesFluxCorr;
+    Vector<MultiFab> Dref(finest_level + 1);
+    Real times[2] = {0.0};
+    for (int pass = 0; pass < 2; ++pass) {
+      m_fusedSpeciesFluxCorr = pass;
+      for (int r = 0; r < nrep; ++r) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+            MultiFab::Copy(
+              fluxes[lev][idim], fluxes0[lev][idim], 0, 0, NUM_SPECIES, 0);
+          }
+        }
+        Gpu::streamSynchronize();
+        Real start = ParallelDescriptor::second();
+        correctSpeciesFluxes(GetVecOfArrOfPtrs(fluxes), diffData);
+        Gpu::streamSynchronize();
+        times[pass] += ParallelDescriptor::second() - start;
+      }
+      if (pass == 0) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          Dref[lev].define(grids[lev], dmap[lev], NUM_SPECIES, 0);
+          MultiFab::Copy(Dref[lev], diffData->Dhat[lev], 0, 0, NUM_SPECIES, 0);
+        }
+      }
+    }
+    m_fusedSpeciesFluxCorr = fusedSave;
+
+    ParallelDescriptor::ReduceRealMax(
+      times, 2, ParallelDescriptor::IOProcessorNumber());
+    const Real faceGB = static_cast<Real>(nrep * faceBytes) * 1.0e-9;
+    Print() << "    Species flux correction (" << nrep << " repetitions, "
+            << static_cast<Real>(faceBytes) / (1024.0 * 1024.0)
+            << " MB of species fluxes): default " << times[0] << " s ("
+            << faceGB / times[0] << " GB/s), fused " << times[1] << " s ("
+            << faceGB / times[1] << " GB/s)\n";
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      MultiFab::Copy(
+        *a_MFVec[lev], diffData->Dhat[lev], 0, a_comp, NUM_SPECIES, 0);
+      MultiFab::Subtract(*a_MFVec[lev], Dref[lev], 0, a_comp, NUM_SPECIES, 0);
+      Real errMax = 0.0;
+      for (int n = 0; n < NUM_SPECIES; ++n) {
+        const Real scale = Dref[lev].norm0(n);
+        a_MFVec[lev]->mult(1.0 / amrex::max(scale, 1.0e-30), a_comp + n, 1);
+        errMax = std::max(errMax, a_MFVec[lev]->norm0(a_comp + n));
+      }
+      Print() << "    Level " << lev << " max relative difference: " << errMax
+              << "\n";
+    }
+    nComp = NUM_SPECIES;
+  } else if (a_var == "mcDiffusion") {
+    // Time the species diffusion term with the Stefan-Maxwell and the
+    // mixture-averaged fluxes. The difference of the species diffusion terms
+    // is scaled by the max of each mixture-averaged term on the level.
+    if (m_multiCompDiff == 0) {
+      amrex::Abort(
+        "mcDiffusion evaluation requires peleLM.multicomponent_diffusion");
+    }
+    std::unique_ptr<AdvanceDiffData> diffData;
+    diffData = std::make_unique<AdvanceDiffData>(
+      finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar,
+      m_use_soret);
+    calcDiffusivity(AmrNewTime);
+    constexpr int nrep = 10;
+    Vector<MultiFab> Dref(finest_level + 1);
+    Real times[2] = {0.0};
+    for (int pass = 0; pass < 2; ++pass) {
+      // Mixture-averaged first, then Stefan-Maxwell
+      m_multiCompDiff = pass;
+      Real start = ParallelDescriptor::second();
+      for (int r = 0; r < nrep; ++r) {
+        computeDifferentialDiffusionTerms(AmrNewTime, diffData);
+      }
+      Gpu::streamSynchronize();
+      times[pass] = ParallelDescriptor::second() - start;
+      if (pass == 0) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          Dref[lev].define(grids[lev], dmap[lev], NUM_SPECIES, 0);
+          MultiFab::Copy(Dref[lev], diffData->Dnp1[lev], 0, 0, NUM_SPECIES, 0);
+        }
+      }
+    }
+
+    Long ncells = 0;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      ncells += grids[lev].numPts();
+    }
+    ParallelDescriptor::ReduceRealMax(
+      times, 2, ParallelDescriptor::IOProcessorNumber());
+    Print() << "    Species diffusion term (" << nrep << " repetitions, "
+            << ncells << " cells): mixture-averaged " << times[0] << " s ("
+            << static_cast<Real>(nrep * ncells) / times[0] * 1.0e-6
+            << " Mcells/s), Stefan-Maxwell " << times[1] << " s ("
+            << static_cast<Real>(nrep * ncells) / times[1] * 1.0e-6
+            << " Mcells/s)\n";
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      MultiFab::Copy(
+        *a_MFVec[lev], diffData->Dnp1[lev], 0, a_comp, NUM_SPECIES, 0);
+      MultiFab::Subtract(*a_MFVec[lev], Dref[lev], 0, a_comp, NUM_SPECIES, 0);
+      Real errMax = 0.0;
+      for (int n = 0; n < NUM_SPECIES; ++n) {
+        const Real scale = Dref[lev].norm0(n);
+        a_MFVec[lev]->mult(1.0 / amrex::max(scale, 1.0e-30), a_comp + n, 1);
+        errMax = std::max(errMax, a_MFVec[lev]->norm0(a_comp + n));
+      }
+      Print() << "    Level " << lev
+              << " max relative difference to mixture-averaged: " << errMax
+              << "\n";
+    }
+    nComp = NUM_SPECIES;
+  } else if (a_var == "scalarAdvFused") {
+    if (m_fusedScalarAdv == 0) {
+      amrex::Abort(
+        "scalarAdvFused evaluation requires peleLM.fused_scalar_advection");
+    }
+    Vector<std::unique_ptr<MultiFab>> aliasMF(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      aliasMF[lev] = std::make_unique<MultiFab>(
+        *a_MFVec[lev], amrex::make_alias, a_comp, NUM_SPECIES + 2);
+    }
+    evaluateAdvectionTerms(GetVecOfPtrs(aliasMF), 1);
+    nComp = NUM_SPECIES + 2;
   } else if (a_var == "velForce") {
     // Velocity forces used in computing the velocity advance
     int add_gradP = 0;
@@ -351,7 +687,7 @@ PeleLM::evaluateChemExtForces(
 
 void
 PeleLM::evaluateAdvectionTerms(
-  const amrex::Vector<amrex::MultiFab*>& a_advTerms)
+  const amrex::Vector<amrex::MultiFab*>& a_advTerms, int a_compareFused)
 {
   //----------------------------------------------------------------
   // Copy old <- new state
@@ -429,6 +765,11 @@ PeleLM::evaluateAdvectionTerms(
 
   // Get AofS: (\nabla \cdot (\rho Y Umac))^{n+1/2,k}
   // and for density = \sum_k AofS_k
+  if (a_compareFused != 0) {
+    compareScalarAdvTerms(advData, a_advTerms);
+    copyStateOldToNew();
+    return;
+  }
   computeScalarAdvTerms(advData);
 
   // Compute t^{n+1/2} velocity advection term
@@ -442,3 +783,62 @@ PeleLM::evaluateAdvectionTerms(
   // Reset state
   copyStateOldToNew();
 }
+
+void
+PeleLM::compareScalarAdvTerms(
+  std::unique_ptr<AdvanceAdvData>& advData,
+  const amrex::Vector<amrex::MultiFab*>& a_relDiff)
+{
+  // Time the default and fused scalar advection over a number of
+  // repetitions. The difference of the Rho, RhoY and RhoH terms is scaled by
+  // the max of each default term on the level.
+  constexpr int nrep = 10;
+  constexpr int ncomp = NUM_SPECIES + 2;
+  const int fusedSave = m_fusedScalarAdv;
+  Vector<MultiFab> AofSref(finest_level + 1);
+  Real times[2] = {0.0};
+  for (int pass = 0; pass < 2; ++pass) {
+    m_fusedScalarAdv = pass;
+    Real start = ParallelDescriptor::second();
+    for (int r = 0; r < nrep; ++r) {
+      computeScalarAdvTerms(advData);
+    }
+    Gpu::streamSynchronize();
+    times[pass] = ParallelDescriptor::second() - start;
+    if (pass == 0) {
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        AofSref[lev].define(grids[lev], dmap[lev], ncomp, 0);
+        MultiFab::Copy(AofSref[lev], advData->AofS[lev], DENSITY, 0, ncomp, 0);
+      }
+    }
+  }
+  m_fusedScalarAdv = fusedSave;
+
+  Long ncells = 0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    ncells += grids[lev].numPts();
+    MultiFab::Copy(*a_relDiff[lev], advData->AofS[lev], DENSITY, 0, ncomp, 0);
+    MultiFab::Subtract(*a_relDiff[lev], AofSref[lev], 0, 0, ncomp, 0);
+    for (int n = 0; n < ncomp; ++n) {
+      const Real scale = AofSref[lev].norm0(n);
+      a_relDiff[lev]->mult(1.0 / amrex::max(scale, 1.0e-30), n, 1);
+    }
+  }
+
+  ParallelDescriptor::ReduceRealMax(
+    times, 2, ParallelDescriptor::IOProcessorNumber());
+  Print() << "    Scalar advection (" << nrep << " repetitions, " << ncells
+          << " cells): default " << times[0] << " s ("
+          << static_cast<Real>(nrep * ncells) / times[0] * 1.0e-6
+          << " Mcells/s), fused " << times[1] << " s ("
+          << static_cast<Real>(nrep * ncells) / times[1] * 1.0e-6
+          << " Mcells/s)\n";
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    Real errMax = 0.0;
+    for (int n = 0; n < ncomp; ++n) {
+      errMax = std::max(errMax, a_relDiff[lev]->norm0(n));
+    }
+    Print() << "    Level " << lev << " max relative difference: " << errMax
+            << "\n";
+  }
+}
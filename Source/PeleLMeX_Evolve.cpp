@@ -13,6 +13,9 @@ PeleLM::Evolve()
   int plt_justDidIt = 0;
   int chk_justDidIt = 0;
 
+  // Discard the initial grid generation
+  m_regridReport.resetTimes();
+
   while (!do_not_evolve) {
 
     plt_justDidIt = 0;
@@ -34,9 +37,30 @@ PeleLM::Evolve()
       if (m_incompressible == 0) {
         averageDownReaction();
       }
+      if (m_regridReport.isActive()) {
+        m_regridReport.begin(grids, dmap, getLayoutEfficiency());
+      }
       regrid(0, m_cur_time);
+      Real t0 = m_regridReport.start();
       resetMacProjector();
+      m_regridReport.stop(RegridReport::ResetMacProjector, t0);
+      t0 = m_regridReport.start();
       resetCoveredMask();
+      m_regridReport.stop(RegridReport::ResetCoveredMask, t0);
+      if (m_regridReport.isActive()) {
+        // Level data moved by RemakeLevel
+        Long nCompMoved =
+          m_leveldata_new[0]->state.nComp() + m_leveldata_new[0]->gp.nComp();
+        if (m_incompressible == 0 && m_has_divu != 0) {
+          nCompMoved += m_leveldata_new[0]->divu.nComp();
+        }
+        if (m_do_react != 0) {
+          nCompMoved += m_leveldatareact[0]->I_R.nComp();
+        }
+        m_regridReport.end(
+          m_nstep, m_cur_time, grids, dmap, getLayoutEfficiency(),
+          nCompMoved * static_cast<Long>(sizeof(Real)));
+      }
 #ifdef PELE_USE_SPRAY
       regridded = true;
 #endif
@@ -48,6 +72,14 @@ PeleLM::Evolve()
       SprayPostRegrid();
     }
 #endif
+
+    // Generate the grids of the next step regrid ahead of time
+    if (
+      (m_regridLookahead != 0) && (m_regrid_int > 0) &&
+      ((m_nstep + 1) % m_regrid_int == 0)) {
+      computeLookaheadGrids(m_cur_time);
+    }
+
     int is_init = 0;
     Advance(is_init);
     m_nstep++;
@@ -31,6 +31,9 @@ PeleLM::MakeNewLevelFromScratch(
 {
   BL_PROFILE("PeleLMeX::MakeNewLevelFromScratch()");
 
+  // Pooled MFs no longer match the level grids
+  m_mfPool.clearLevel(lev);
+
   if (m_verbose > 0) {
     amrex::Print() << " Making new level " << lev << " from scratch"
                    << std::endl;
@@ -54,20 +57,20 @@ PeleLM::MakeNewLevelFromScratch(
   SetDistributionMap(lev, dm);
 
   // Define the FAB Factory
-#ifdef AMREX_USE_EB
-  m_factory[lev] = makeEBFabFactory(
-    geom[lev], grids[lev], dmap[lev], {6, 6, 6}, EBSupport::full);
-#else
-  m_factory[lev] = std::make_unique<FArrayBoxFactory>();
-#endif
+  std::unique_ptr<FabFactory<FArrayBox>> new_fact =
+    makeLevelFactory(lev, grids[lev], dmap[lev]);
+  retireLevelFactory(lev);
+  m_factory[lev] = std::move(new_fact);
 
   // Initialize the LevelData
   m_leveldata_old[lev] = std::make_unique<LevelData>(
     grids[lev], dmap[lev], *m_factory[lev], m_incompressible, m_has_divu,
-    m_nAux, m_nGrowState, m_use_soret, static_cast<int>(m_do_les));
+    m_nAux, m_nGrowState, m_use_soret, static_cast<int>(m_do_les),
+    static_cast<int>(m_lowMemTransport == 0));
   m_leveldata_new[lev] = std::make_unique<LevelData>(
     grids[lev], dmap[lev], *m_factory[lev], m_incompressible, m_has_divu,
     m_nAux, m_nGrowState, m_use_soret, static_cast<int>(m_do_les));
+  shareDiffusivity(lev);
 
   if (max_level > 0 && lev != max_level) {
     m_coveredMask[lev] =
@@ -107,6 +110,7 @@ PeleLM::MakeNewLevelFromScratch(
 
   // Load balance
   m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
+  m_costMeasure.defineLevel(lev, ba, dm);
 
   // Mac projector
 #ifdef AMREX_USE_EB
@@ -427,14 +431,10 @@ PeleLM::projectInitSolution()
           MultiFab Forcing(grids[lev], dmap[lev], nCompForcing(), 0);
           Forcing.setVal(0.0);
 
-          if (lev != finest_level) {
+          if (useChemLayout(lev)) {
             advanceChemistryBAChem(lev, dtInit / 2.0, Forcing);
           } else {
-            if (m_max_grid_size_chem.min() > 0) {
-              advanceChemistryBAChem(lev, dtInit / 2.0, Forcing);
-            } else {
-              advanceChemistry(lev, dtInit / 2.0, Forcing);
-            }
+            advanceChemistry(lev, dtInit / 2.0, Forcing);
           }
           if (m_doLoadBalance != 0) {
             loadBalanceChemLev(lev);
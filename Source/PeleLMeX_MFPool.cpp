@@ -0,0 +1,100 @@
+#include <PeleLMeX_MFPool.H>
+
+using namespace amrex;
+
+void
+MFPool::define(int a_nlevels, bool a_active)
+{
+  clear();
+  m_free.resize(a_nlevels);
+  m_active = a_active;
+}
+
+MultiFab
+MFPool::acquire(
+  int lev,
+  const BoxArray& ba,
+  const DistributionMapping& dm,
+  int ncomp,
+  const IntVect& ngrow,
+  const FabFactory<FArrayBox>& factory)
+{
+  if (m_active) {
+    AMREX_ASSERT(lev < m_free.size());
+    auto& lfree = m_free[lev];
+    for (auto it = lfree.begin(); it != lfree.end(); ++it) {
+      if (
+        it->nComp() == ncomp && it->nGrowVect() == ngrow &&
+        it->ixType() == ba.ixType() && it->DistributionMap() == dm &&
+        it->boxArray() == ba) {
+        MultiFab mf(std::move(*it));
+        lfree.erase(it);
+        m_bytesCached -= localBytes(mf);
+        m_nAllocAvoided += 1;
+        return mf;
+      }
+    }
+  }
+  m_nAllocs += 1;
+  return MultiFab(ba, dm, ncomp, ngrow, MFInfo(), factory);
+}
+
+void
+MFPool::release(int lev, MultiFab&& a_mf)
+{
+  if (!m_active || !a_mf.ok()) {
+    return;
+  }
+  AMREX_ASSERT(lev < m_free.size());
+  m_bytesCached += localBytes(a_mf);
+  m_bytesCachedHWM = std::max(m_bytesCachedHWM, m_bytesCached);
+  m_free[lev].push_back(std::move(a_mf));
+}
+
+void
+MFPool::release(Vector<MultiFab>& a_mfs)
+{
+  for (int lev = 0; lev < a_mfs.size(); ++lev) {
+    release(lev, std::move(a_mfs[lev]));
+  }
+}
+
+void
+MFPool::release(Vector<Array<MultiFab, AMREX_SPACEDIM>>& a_mfs)
+{
+  for (int lev = 0; lev < a_mfs.size(); ++lev) {
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+      release(lev, std::move(a_mfs[lev][idim]));
+    }
+  }
+}
+
+void
+MFPool::clearLevel(int lev)
+{
+  if (lev >= m_free.size()) {
+    return;
+  }
+  for (const auto& mf : m_free[lev]) {
+    m_bytesCached -= localBytes(mf);
+  }
+  m_free[lev].clear();
+}
+
+void
+MFPool::clear()
+{
+  for (int lev = 0; lev < m_free.size(); ++lev) {
+    clearLevel(lev);
+  }
+}
+
+Long
+MFPool::localBytes(const MultiFab& a_mf)
+{
+  Long nbytes = 0;
+  for (int i = 0; i < a_mf.local_size(); ++i) {
+    nbytes += a_mf.atLocalIdx(i).nBytes();
+  }
+  return nbytes;
+}
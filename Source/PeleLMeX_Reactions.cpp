@@ -3,25 +3,106 @@
 #ifdef PELE_USE_EFIELD
 #include <PeleLMeX_EF_Constants.H>
 #endif
+#include <AMReX_ParallelReduce.H>
 
 using namespace amrex;
 
+namespace {
+// Max mass fraction change over a step due to the reaction term of the
+// previous SDC iterate, on the uncovered cells of each local box (MKS
+// units). The kernels of all the boxes are launched before a single copy
+// of the result to the host.
+Vector<Real>
+chemActivity(
+  const MultiFab& a_state,
+  int a_rhoYcomp,
+  const MultiFab& a_IR,
+  const iMultiFab& a_mask,
+  Real a_dt)
+{
+  Gpu::DeviceVector<Real> activity_d(a_state.local_size(), 0.0);
+  Real* activity = activity_d.data();
+  // No tiling: each box is reduced by a single thread
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(a_state); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.validbox();
+    auto const& rhoY = a_state.const_array(mfi, a_rhoYcomp);
+    auto const& I_R = a_IR.const_array(mfi);
+    auto const& mask = a_mask.const_array(mfi);
+    Real* boxActivity = activity + mfi.LocalIndex();
+    ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      // EB-covered cells (mask < 0) do not count
+      if (mask(i, j, k) < 0) {
+        return;
+      }
+      Real rho = 0.0;
+      Real dRhoY = 0.0;
+      for (int n = 0; n < NUM_SPECIES; n++) {
+        rho += rhoY(i, j, k, n);
+        dRhoY = amrex::max(dRhoY, std::abs(I_R(i, j, k, n)));
+      }
+      Gpu::Atomic::Max(boxActivity, a_dt * dRhoY / rho);
+    });
+  }
+  Vector<Real> activity_h(activity_d.size());
+  Gpu::copy(
+    Gpu::deviceToHost, activity_d.begin(), activity_d.end(),
+    activity_h.begin());
+  return activity_h;
+}
+
+// Explicit update of a box using the reaction term of the previous SDC
+// iterate, in place of the chemistry integration (CGS units, but I_R).
+// The temperature is recovered from the updated state, as the integrator
+// would do, starting from the incoming value.
+void
+laggedChemUpdate(
+  const Box& bx,
+  Array4<Real> const& rhoY,
+  Array4<Real> const& rhoH,
+  Array4<Real> const& temp,
+  Array4<const Real> const& extF_rhoY,
+  Array4<const Real> const& extF_rhoH,
+  Array4<const Real> const& I_R,
+  Array4<Real> const& fcl,
+  Real a_dt)
+{
+  ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+    auto eos = pele::physics::PhysicsType::eos();
+    Real rho = 0.0;
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      rhoY(i, j, k, n) +=
+        a_dt * (extF_rhoY(i, j, k, n) + I_R(i, j, k, n) * 1.0e-3);
+      rho += rhoY(i, j, k, n);
+    }
+    rhoH(i, j, k) += a_dt * extF_rhoH(i, j, k);
+    Real rhoinv = 1.0 / rho;
+    Real y[NUM_SPECIES] = {0.0};
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      y[n] = rhoY(i, j, k, n) * rhoinv;
+    }
+    Real T = temp(i, j, k);
+    eos.HY2T(rhoH(i, j, k) * rhoinv, y, T);
+    temp(i, j, k) = T;
+    fcl(i, j, k) = 0.0;
+  });
+}
+} // namespace
+
 void
 PeleLM::advanceChemistry(std::unique_ptr<AdvanceAdvData>& advData)
 {
   BL_PROFILE("PeleLMeX::advanceChemistry()");
 
   for (int lev = finest_level; lev >= 0; --lev) {
-    if (lev != finest_level) {
+    // If we defined a new BA for chem on finest level, use that instead of
+    // the default one
+    if (useChemLayout(lev)) {
       advanceChemistryBAChem(lev, m_dt, advData->Forcing[lev]);
     } else {
-      // If we defined a new BA for chem on finest level, use that instead of
-      // the default one
-      if (m_max_grid_size_chem.min() > 0) {
-        advanceChemistryBAChem(lev, m_dt, advData->Forcing[lev]);
-      } else {
-        advanceChemistry(lev, m_dt, advData->Forcing[lev]);
-      }
+      advanceChemistry(lev, m_dt, advData->Forcing[lev]);
     }
   }
 }
@@ -36,6 +117,7 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
   auto* ldataOld_p = getLevelDataPtr(lev, AmrOldTime);
   auto* ldataNew_p = getLevelDataPtr(lev, AmrNewTime);
   auto* ldataR_p = getLevelDataReactPtr(lev);
+  const bool cacheInstRR = prepareReactionCache(lev);
 
   // Setup EB-covered cells mask
   iMultiFab mask(grids[lev], dmap[lev], 1, 0);
@@ -45,6 +127,19 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
   mask.setVal(1);
 #endif
 
+  // Multi-rate: reuse the previous iterate reaction term in inactive boxes
+  const bool multiRate = useMultiRateChem();
+  Vector<int> skipBox(ldataNew_p->state.local_size(), 0);
+  Long nSkipped = 0;
+  if (multiRate) {
+    const auto activity =
+      chemActivity(ldataOld_p->state, FIRSTSPEC, ldataR_p->I_R, mask, a_dt);
+    for (int ib = 0; ib < static_cast<int>(skipBox.size()); ++ib) {
+      skipBox[ib] = (activity[ib] < m_multiRateTol) ? 1 : 0;
+      nSkipped += skipBox[ib];
+    }
+  }
+
   MFItInfo mfi_info;
   if (Gpu::notInLaunchRegion()) {
     mfi_info.EnableTiling().SetDynamic(true);
@@ -62,8 +157,15 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
     auto const& temp_n = ldataNew_p->state.array(mfi, TEMP);
     auto const& extF_rhoY = a_extForcing.array(mfi, 0);
     auto const& extF_rhoH = a_extForcing.array(mfi, NUM_SPECIES);
+#ifdef PELE_USE_FLOAT_AUX
+    // The integrator counts function calls in Real, stored in AuxReal
+    FArrayBox fctC_fab(bx, 1, The_Async_Arena());
+    auto const& fcl = fctC_fab.array();
+#else
     auto const& fcl = ldataR_p->functC.array(mfi);
+#endif
     auto const& mask_arr = mask.array(mfi);
+    auto const& rhoYdot_prev = ldataR_p->I_R.const_array(mfi);
 
     // Reset new to old and convert MKS -> CGS
     ParallelFor(
@@ -95,17 +197,32 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
       });
 #endif
 
-    Real dt_incr = a_dt;
-    Real time_chem = 0;
-    /* Solve */
-    m_reactor->react(
-      bx, rhoY_n, extF_rhoY, temp_n, rhoH_n, extF_rhoH, fcl, mask_arr, dt_incr,
-      time_chem
+    const Real t0 = m_costMeasure.start();
+    if (skipBox[mfi.LocalIndex()] != 0) {
+      laggedChemUpdate(
+        bx, rhoY_n, rhoH_n, temp_n, extF_rhoY, extF_rhoH, rhoYdot_prev, fcl,
+        a_dt);
+    } else {
+      Real dt_incr = a_dt;
+      Real time_chem = 0;
+      /* Solve */
+      m_reactor->react(
+        bx, rhoY_n, extF_rhoY, temp_n, rhoH_n, extF_rhoH, fcl, mask_arr,
+        dt_incr, time_chem
 #ifdef AMREX_USE_GPU
-      ,
-      amrex::Gpu::gpuStream()
+        ,
+        amrex::Gpu::gpuStream()
+#endif
+      );
+    }
+    m_costMeasure.stop(lev, mfi, t0, CostMeasure::Chemistry);
+#ifdef PELE_USE_FLOAT_AUX
+    auto const& fcl_aux = ldataR_p->functC.array(mfi);
+    ParallelFor(
+      bx, [fcl, fcl_aux] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        fcl_aux(i, j, k) = static_cast<AuxReal>(fcl(i, j, k));
+      });
 #endif
-    );
 
     // Convert CGS -> MKS
     ParallelFor(
@@ -137,6 +254,9 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
     Gpu::Device::streamSynchronize();
 #endif
   }
+  if (multiRate) {
+    reportMultiRateChem(lev, nSkipped, ldataNew_p->state.local_size());
+  }
 
   // Set reaction term
 #ifdef AMREX_USE_OMP
@@ -159,6 +279,20 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
           extF_rhoY(i, j, k, n);
       });
 
+    // Instantaneous RR of the post-chemistry state, while in cache
+    if (cacheInstRR) {
+      auto const& rhoH_n = ldataNew_p->state.const_array(mfi, RHOH);
+      auto const& temp_n = ldataNew_p->state.const_array(mfi, TEMP);
+      auto const& instRR = ldataR_p->I_R_inst.array(mfi);
+      auto const& mask_arr = mask.const_array(mfi);
+      ParallelFor(
+        bx, [rhoY_n, rhoH_n, temp_n, instRR,
+             mask_arr] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          reactionRateRhoYMasked(
+            i, j, k, rhoY_n, rhoH_n, temp_n, mask_arr, instRR);
+        });
+    }
+
 #ifdef PELE_USE_EFIELD
     auto const& nE_o = ldataOld_p->state.const_array(mfi, NE);
     auto const& nE_n = ldataNew_p->state.const_array(mfi, NE);
@@ -172,6 +306,7 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
       });
 #endif
   }
+  ldataR_p->instRRCached = cacheInstRR ? 1 : 0;
 }
 
 // This advanceChemistry works with BoxArrays built such that each box
@@ -186,11 +321,12 @@ PeleLM::advanceChemistryBAChem(
   auto* ldataOld_p = getLevelDataPtr(lev, AmrOldTime);
   auto* ldataNew_p = getLevelDataPtr(lev, AmrNewTime);
   auto* ldataR_p = getLevelDataReactPtr(lev);
+  const bool cacheInstRR = prepareReactionCache(lev);
 
   // Set chemistry MFs based on baChem and dmapChem
   MultiFab chemState(*m_baChem[lev], *m_dmapChem[lev], NUM_SPECIES + 3, 0);
   MultiFab chemForcing(*m_baChem[lev], *m_dmapChem[lev], nCompForcing(), 0);
-  MultiFab functC(*m_baChem[lev], *m_dmapChem[lev], 1, 0);
+  AuxMultiFab functC(*m_baChem[lev], *m_dmapChem[lev], 1, 0);
 #ifdef PELE_USE_EFIELD
   MultiFab chemnE(*m_baChem[lev], *m_dmapChem[lev], 1, 0);
 #endif
@@ -203,117 +339,220 @@ PeleLM::advanceChemistryBAChem(
   mask.setVal(1);
 #endif
 
-  // ParallelCopy into chem MFs
-  chemState.ParallelCopy(ldataOld_p->state, FIRSTSPEC, 0, NUM_SPECIES + 3);
-  chemForcing.ParallelCopy(a_extForcing, 0, 0, nCompForcing());
+  // ParallelCopy into chem MFs. The local part of the copy is done when
+  // posting the communications: boxes whose data is entirely owned by this
+  // rank are integrated while the remote data is in flight.
+  chemState.ParallelCopy_nowait(
+    ldataOld_p->state, FIRSTSPEC, 0, NUM_SPECIES + 3);
+  chemForcing.ParallelCopy_nowait(a_extForcing, 0, 0, nCompForcing());
 #ifdef PELE_USE_EFIELD
-  chemnE.ParallelCopy(ldataOld_p->state, NE, 0, 1);
+  chemnE.ParallelCopy_nowait(ldataOld_p->state, NE, 0, 1);
 #endif
+  const bool multiRate = useMultiRateChem();
+  MultiFab chemIR;
+  if (multiRate) {
+    chemIR.define(*m_baChem[lev], *m_dmapChem[lev], NUM_SPECIES, 0);
+    chemIR.ParallelCopy_nowait(ldataR_p->I_R, 0, 0, NUM_SPECIES);
+  }
+
+  // EB-covered cells mask on the level layout for the activity and the
+  // cached RR
+  iMultiFab levMask;
+  if (multiRate || cacheInstRR) {
+    levMask.define(grids[lev], dmap[lev], 1, 0);
+#ifdef AMREX_USE_EB
+    getCoveredIMask(lev, levMask);
+#else
+    levMask.setVal(1);
+#endif
+  }
+
+  // Multi-rate: the activity is evaluated on the level layout, where the
+  // old state and the previous reaction term do not need a copy. A chem.
+  // box is inactive if all the level boxes it intersects are.
+  Vector<int> gridActive;
+  if (multiRate) {
+    const auto activity =
+      chemActivity(ldataOld_p->state, FIRSTSPEC, ldataR_p->I_R, levMask, a_dt);
+    gridActive.resize(grids[lev].size(), 0);
+    for (MFIter mfi(ldataOld_p->state, false); mfi.isValid(); ++mfi) {
+      gridActive[mfi.index()] =
+        (activity[mfi.LocalIndex()] < m_multiRateTol) ? 0 : 1;
+    }
+    ParallelAllReduce::Max(
+      gridActive.data(), static_cast<int>(gridActive.size()),
+      ParallelContext::CommunicatorSub());
+  }
+  Vector<int> skipBox(m_baChem[lev]->size(), 0);
+  Long nBoxes = 0;
+  Long nSkipped = 0;
+
+  Vector<int> localChemBox(m_baChem[lev]->size(), 0);
+  for (MFIter mfi(chemState, false); mfi.isValid(); ++mfi) {
+    int isLocal = 1;
+    int isActive = 0;
+    for (const auto& is : grids[lev].intersections(mfi.validbox())) {
+      if (dmap[lev][is.first] != ParallelDescriptor::MyProc()) {
+        isLocal = 0;
+      }
+      if (multiRate) {
+        isActive = amrex::max(isActive, gridActive[is.first]);
+      }
+    }
+    localChemBox[mfi.index()] = isLocal;
+    if (multiRate && m_baChemFlag[lev][mfi.index()] != 0) {
+      skipBox[mfi.index()] = 1 - isActive;
+      nBoxes += 1;
+      nSkipped += skipBox[mfi.index()];
+    }
+  }
 
   MFItInfo mfi_info;
   if (Gpu::notInLaunchRegion()) {
     mfi_info.EnableTiling().SetDynamic(true);
   }
+  for (int remotePass = 0; remotePass < 2; ++remotePass) {
+    if (remotePass == 1) {
+      chemState.ParallelCopy_finish();
+      chemForcing.ParallelCopy_finish();
+#ifdef PELE_USE_EFIELD
+      chemnE.ParallelCopy_finish();
+#endif
+      if (multiRate) {
+        chemIR.ParallelCopy_finish();
+      }
+    }
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-  for (MFIter mfi(chemState, mfi_info); mfi.isValid(); ++mfi) {
-    const Box& bx = mfi.tilebox();
-    auto const& rhoY_o = chemState.array(mfi, 0);
-    auto const& rhoH_o = chemState.array(mfi, NUM_SPECIES);
-    auto const& temp_o = chemState.array(mfi, NUM_SPECIES + 1);
-    auto const& extF_rhoY = chemForcing.array(mfi, 0);
-    auto const& extF_rhoH = chemForcing.array(mfi, NUM_SPECIES);
-    auto const& fcl = functC.array(mfi);
-    auto const& mask_arr = mask.array(mfi);
+    for (MFIter mfi(chemState, mfi_info); mfi.isValid(); ++mfi) {
+      if (localChemBox[mfi.index()] == remotePass) {
+        continue;
+      }
+      const Box& bx = mfi.tilebox();
+      // Do reaction only on uncovered box
+      int do_reactionBox = m_baChemFlag[lev][mfi.index()];
+      auto const& rhoY_o = chemState.array(mfi, 0);
+      auto const& rhoH_o = chemState.array(mfi, NUM_SPECIES);
+      auto const& temp_o = chemState.array(mfi, NUM_SPECIES + 1);
+      auto const& extF_rhoY = chemForcing.array(mfi, 0);
+      auto const& extF_rhoH = chemForcing.array(mfi, NUM_SPECIES);
+#ifdef PELE_USE_FLOAT_AUX
+      // The integrator counts function calls in Real, stored in AuxReal
+      FArrayBox fctC_fab(bx, 1, The_Async_Arena());
+      auto const& fcl = fctC_fab.array();
+#else
+      auto const& fcl = functC.array(mfi);
+#endif
+      auto const& mask_arr = mask.array(mfi);
 
-    // Convert MKS -> CGS
-    ParallelFor(
-      bx, [rhoY_o, rhoH_o, extF_rhoY,
-           extF_rhoH] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        for (int n = 0; n < NUM_SPECIES; n++) {
-          rhoY_o(i, j, k, n) *= 1.0e-3;
-          extF_rhoY(i, j, k, n) *= 1.0e-3;
-        }
-        rhoH_o(i, j, k) *= 10.0;
-        extF_rhoH(i, j, k) *= 10.0;
-      });
+      // Convert MKS -> CGS
+      ParallelFor(
+        bx, [rhoY_o, rhoH_o, extF_rhoY,
+             extF_rhoH] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            rhoY_o(i, j, k, n) *= 1.0e-3;
+            extF_rhoY(i, j, k, n) *= 1.0e-3;
+          }
+          rhoH_o(i, j, k) *= 10.0;
+          extF_rhoH(i, j, k) *= 10.0;
+        });
 
 #ifdef PELE_USE_EFIELD
-    // Pass nE -> rhoY_e & FnE -> FrhoY_e
-    auto const& nE_o = chemnE.array(mfi);
-    auto const& FnE = chemForcing.array(mfi, NUM_SPECIES + 1);
-    auto const& rhoYe_o = chemState.array(mfi, E_ID);
-    auto const& FrhoYe = chemForcing.array(mfi, E_ID);
-    auto eos = pele::physics::PhysicsType::eos();
-    Real mwt[NUM_SPECIES] = {0.0};
-    eos.molecular_weight(mwt);
-    ParallelFor(
-      bx, [mwt, nE_o, FnE, rhoYe_o,
-           FrhoYe] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        rhoYe_o(i, j, k) = nE_o(i, j, k) / Na * mwt[E_ID] * 1.0e-6;
-        FrhoYe(i, j, k) = FnE(i, j, k) / Na * mwt[E_ID] * 1.0e-6;
-      });
+      // Pass nE -> rhoY_e & FnE -> FrhoY_e
+      auto const& nE_o = chemnE.array(mfi);
+      auto const& FnE = chemForcing.array(mfi, NUM_SPECIES + 1);
+      auto const& rhoYe_o = chemState.array(mfi, E_ID);
+      auto const& FrhoYe = chemForcing.array(mfi, E_ID);
+      auto eos = pele::physics::PhysicsType::eos();
+      Real mwt[NUM_SPECIES] = {0.0};
+      eos.molecular_weight(mwt);
+      ParallelFor(
+        bx, [mwt, nE_o, FnE, rhoYe_o,
+             FrhoYe] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          rhoYe_o(i, j, k) = nE_o(i, j, k) / Na * mwt[E_ID] * 1.0e-6;
+          FrhoYe(i, j, k) = FnE(i, j, k) / Na * mwt[E_ID] * 1.0e-6;
+        });
 #endif
 
-    // Do reaction only on uncovered box
-    int do_reactionBox = m_baChemFlag[lev][mfi.index()];
-
-    if (do_reactionBox != 0) {
-      // Do reaction as usual using PelePhysics chemistry integrator
-      Real dt_incr = a_dt;
-      Real time_chem = 0;
-      /* Solve */
-      m_reactor->react(
-        bx, rhoY_o, extF_rhoY, temp_o, rhoH_o, extF_rhoH, fcl, mask_arr,
-        dt_incr, time_chem
+      if (skipBox[mfi.index()] != 0) {
+        // Lagged reaction term in an inactive box
+        const Real t0 = m_costMeasure.start();
+        laggedChemUpdate(
+          bx, rhoY_o, rhoH_o, temp_o, extF_rhoY, extF_rhoH,
+          chemIR.const_array(mfi), fcl, a_dt);
+        m_costMeasure.stopChem(lev, mfi, t0);
+      } else if (do_reactionBox != 0) {
+        // Do reaction as usual using PelePhysics chemistry integrator
+        Real dt_incr = a_dt;
+        Real time_chem = 0;
+        const Real t0 = m_costMeasure.start();
+        /* Solve */
+        m_reactor->react(
+          bx, rhoY_o, extF_rhoY, temp_o, rhoH_o, extF_rhoH, fcl, mask_arr,
+          dt_incr, time_chem
 #ifdef AMREX_USE_GPU
-        ,
-        amrex::Gpu::gpuStream()
+          ,
+          amrex::Gpu::gpuStream()
+#endif
+        );
+        m_costMeasure.stopChem(lev, mfi, t0);
+      } else {
+        // Just set the function call to 0.0
+        ParallelFor(bx, [fcl] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          fcl(i, j, k) = 0.0;
+        });
+      }
+#ifdef PELE_USE_FLOAT_AUX
+      auto const& fcl_aux = functC.array(mfi);
+      ParallelFor(
+        bx, [fcl, fcl_aux] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          fcl_aux(i, j, k) = static_cast<AuxReal>(fcl(i, j, k));
+        });
 #endif
-      );
-    } else {
-      // Just set the function call to 0.0
-      ParallelFor(bx, [fcl] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        fcl(i, j, k) = 0.0;
-      });
-    }
 
-    // Convert CGS -> MKS
-    ParallelFor(
-      bx, [rhoY_o, rhoH_o] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        for (int n = 0; n < NUM_SPECIES; n++) {
-          rhoY_o(i, j, k, n) *= 1.0e3;
-        }
-        rhoH_o(i, j, k) *= 0.1;
-      });
+      // Convert CGS -> MKS
+      ParallelFor(
+        bx, [rhoY_o, rhoH_o] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            rhoY_o(i, j, k, n) *= 1.0e3;
+          }
+          rhoH_o(i, j, k) *= 0.1;
+        });
 
 #ifdef PELE_USE_EFIELD
-    // rhoY_e -> nE and set rhoY_e to zero
-    Real invmwt[NUM_SPECIES] = {0.0};
-    eos.inv_molecular_weight(invmwt);
-    ParallelFor(
-      bx,
-      [invmwt, nE_o, rhoYe_o] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        nE_o(i, j, k) = rhoYe_o(i, j, k) * Na * invmwt[E_ID] * 1.0e3;
-        rhoYe_o(i, j, k) = 0.0;
-      });
+      // rhoY_e -> nE and set rhoY_e to zero
+      Real invmwt[NUM_SPECIES] = {0.0};
+      eos.inv_molecular_weight(invmwt);
+      ParallelFor(
+        bx,
+        [invmwt, nE_o, rhoYe_o] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          nE_o(i, j, k) = rhoYe_o(i, j, k) * Na * invmwt[E_ID] * 1.0e3;
+          rhoYe_o(i, j, k) = 0.0;
+        });
 #endif
 
 #ifdef AMREX_USE_GPU
-    Gpu::Device::streamSynchronize();
+      Gpu::Device::streamSynchronize();
 #endif
+    }
+  }
+  if (multiRate) {
+    reportMultiRateChem(lev, nSkipped, nBoxes);
   }
 
-  // ParallelCopy into newstate MFs
+  // ParallelCopy into newstate MFs, with the copies in flight together
   // Get the entire new state
   MultiFab StateTemp(grids[lev], dmap[lev], NUM_SPECIES + 3, 0);
-  StateTemp.ParallelCopy(chemState, 0, 0, NUM_SPECIES + 3);
-  ldataR_p->functC.ParallelCopy(functC, 0, 0, 1);
+  StateTemp.ParallelCopy_nowait(chemState, 0, 0, NUM_SPECIES + 3);
+  ldataR_p->functC.ParallelCopy_nowait(functC, 0, 0, 1);
 #ifdef PELE_USE_EFIELD
   MultiFab nETemp(grids[lev], dmap[lev], 1, 0);
-  nETemp.ParallelCopy(chemnE, 0, 0, 1);
+  nETemp.ParallelCopy_nowait(chemnE, 0, 0, 1);
+  nETemp.ParallelCopy_finish();
 #endif
+  StateTemp.ParallelCopy_finish();
+  ldataR_p->functC.ParallelCopy_finish();
 
   // Pass from temp state MF to leveldata and set reaction term
 #ifdef AMREX_USE_OMP
@@ -347,6 +586,18 @@ PeleLM::advanceChemistryBAChem(
         }
       });
 
+    // Instantaneous RR of the post-chemistry state, while in cache
+    if (cacheInstRR) {
+      auto const& instRR = ldataR_p->I_R_inst.array(mfi);
+      auto const& mask_arr = levMask.const_array(mfi);
+      ParallelFor(
+        bx, [rhoY_n, rhoH_n, temp_n, instRR,
+             mask_arr] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          reactionRateRhoYMasked(
+            i, j, k, rhoY_n, rhoH_n, temp_n, mask_arr, instRR);
+        });
+    }
+
 #ifdef PELE_USE_EFIELD
     auto const& nE_arr = nETemp.const_array(mfi);
     auto const& nE_o = ldataOld_p->state.const_array(mfi, NE);
@@ -364,6 +615,35 @@ PeleLM::advanceChemistryBAChem(
       });
 #endif
   }
+  ldataR_p->instRRCached = cacheInstRR ? 1 : 0;
+}
+
+void
+PeleLM::reportMultiRateChem(int lev, Long a_nSkipped, Long a_nBoxes)
+{
+  if (m_verbose > 1) {
+    Long counts[2] = {a_nSkipped, a_nBoxes};
+    ParallelAllReduce::Sum(counts, 2, ParallelContext::CommunicatorSub());
+    Print() << "   Multi-rate chemistry: lagged reaction term in " << counts[0]
+            << " / " << counts[1] << " boxes on level " << lev << "\n";
+  }
+}
+
+bool
+PeleLM::prepareReactionCache(int lev)
+{
+  // I_R and the new state are about to change
+  auto* ldataR_p = getLevelDataReactPtr(lev);
+  ldataR_p->instRRCached = 0;
+  ldataR_p->heatReleaseCached = 0;
+  if (!cacheInstantaneousRR()) {
+    return false;
+  }
+  if (!ldataR_p->I_R_inst.ok()) {
+    ldataR_p->I_R_inst.define(
+      grids[lev], dmap[lev], NUM_SPECIES, 0, MFInfo(), Factory(lev));
+  }
+  return true;
 }
 
 void
@@ -479,17 +759,32 @@ PeleLM::getHeatRelease(int a_lev, MultiFab* a_HR)
   auto* ldataNew_p = getLevelDataPtr(a_lev, AmrNewTime);
   auto* ldataR_p = getLevelDataReactPtr(a_lev);
 
+  // With cache_reaction_terms, the heat release is computed once after each
+  // chemistry integration and shared by the temporals and the plotfiles
+  MultiFab* HR_p = a_HR;
+  if (m_cacheReactionTerms != 0) {
+    if (ldataR_p->heatReleaseCached != 0) {
+      MultiFab::Copy(*a_HR, ldataR_p->heatRelease, 0, 0, 1, 0);
+      return;
+    }
+    if (!ldataR_p->heatRelease.ok()) {
+      ldataR_p->heatRelease.define(
+        grids[a_lev], dmap[a_lev], 1, 0, MFInfo(), Factory(a_lev));
+    }
+    HR_p = &(ldataR_p->heatRelease);
+  }
+
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
   {
-    for (MFIter mfi(*a_HR, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    for (MFIter mfi(*HR_p, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
       const Box& bx = mfi.tilebox();
       FArrayBox EnthFab(bx, NUM_SPECIES, The_Async_Arena());
       auto const& react = ldataR_p->I_R.const_array(mfi, 0);
       auto const& T = ldataNew_p->state.const_array(mfi, TEMP);
       auto const& Hi = EnthFab.array();
-      auto const& HRR = a_HR->array(mfi);
+      auto const& HRR = HR_p->array(mfi);
       amrex::ParallelFor(
         bx, [T, Hi, HRR, react] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
           getHGivenT(i, j, k, T, Hi);
@@ -500,4 +795,9 @@ PeleLM::getHeatRelease(int a_lev, MultiFab* a_HR)
         });
     }
   }
+
+  if (HR_p != a_HR) {
+    ldataR_p->heatReleaseCached = 1;
+    MultiFab::Copy(*a_HR, *HR_p, 0, 0, 1, 0);
+  }
 }
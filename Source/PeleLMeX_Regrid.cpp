@@ -1,5 +1,10 @@
 #include <PeleLMeX.H>
+#include <AMReX_OpenMP.H>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 using namespace amrex;
 
@@ -12,9 +17,25 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
     return;
   }
 
+  if (m_verbose > 1 && !initial) {
+    m_costMeasure.printReport();
+  }
+
+  // Lookahead grids were generated with the box sizes tuned at that time
+  if (
+    (m_autoMaxGridSize != 0) && lbase == 0 && !initial &&
+    (m_lookaheadValid == 0) && m_regrid_file.empty()) {
+    tuneMaxGridSize();
+  }
+
   if (!m_regrid_file.empty()) {
     regridFromGridFile(lbase, time, initial);
 
+  } else if (
+    (m_loadBalanceComposite != 0) && (m_doLoadBalance != 0) && lbase == 0 &&
+    !initial) {
+    regridComposite(time);
+
   } else {
 
     // Load balance base grid
@@ -102,7 +123,19 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
 
     int new_finest;
     Vector<BoxArray> new_grids(finest_level + 2);
-    MakeNewGrids(lbase, time, new_finest, new_grids);
+    if ((m_lookaheadValid != 0) && lbase == 0) {
+      // Grids generated at the previous step, only move the data
+      if (m_verbose > 1) {
+        Print() << " Using lookahead grids\n";
+      }
+      new_finest = m_lookaheadFinest;
+      new_grids = std::move(m_lookaheadGrids);
+      m_lookaheadValid = 0;
+    } else {
+      const Real t0 = m_regridReport.start();
+      MakeNewGrids(lbase, time, new_finest, new_grids);
+      m_regridReport.stop(RegridReport::MakeNewGrids, t0);
+    }
 
     BL_ASSERT(new_finest <= finest_level + 1);
 
@@ -301,6 +334,378 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
   }
 }
 
+namespace {
+// Gather a LayoutData into a vector available on all the ranks
+void
+gatherCostsToAll(const LayoutData<Real>& a_costs, Vector<Real>& a_costsVec)
+{
+  a_costsVec.resize(a_costs.boxArray().size());
+  ParallelDescriptor::GatherLayoutDataToVector(
+    a_costs, a_costsVec, ParallelContext::IOProcessorNumberSub());
+  ParallelDescriptor::Bcast(
+    a_costsVec.data(), a_costsVec.size(),
+    ParallelContext::IOProcessorNumberSub());
+}
+
+// Greedy joint distribution of the boxes of all the levels. The per-rank
+// loads of the fixed levels (non-empty a_pmaps entries) are accounted for
+// first. The boxes of the other levels are then placed from coarse to fine
+// by decreasing cost, on the rank owning most of the covering coarse box
+// if its load stays below a_tol times the average load, on the least
+// loaded rank otherwise. Returns the efficiency: average load / max load.
+Real
+compositeDistribute(
+  const Vector<BoxArray>& a_grids,
+  const Vector<Vector<Real>>& a_costs,
+  const Vector<IntVect>& a_refRatio,
+  Real a_tol,
+  Vector<Vector<int>>& a_pmaps)
+{
+  const int nprocs = ParallelDescriptor::NProcs();
+  const int nlevs = static_cast<int>(a_grids.size());
+
+  Vector<Real> loads(nprocs, 0.0);
+  Real totalCost = 0.0;
+  for (int lev = 0; lev < nlevs; ++lev) {
+    for (int i = 0; i < a_costs[lev].size(); ++i) {
+      totalCost += a_costs[lev][i];
+      if (!a_pmaps[lev].empty()) {
+        loads[a_pmaps[lev][i]] += a_costs[lev][i];
+      }
+    }
+  }
+  const Real target = a_tol * totalCost / static_cast<Real>(nprocs);
+
+  for (int lev = 0; lev < nlevs; ++lev) {
+    if (!a_pmaps[lev].empty()) {
+      continue;
+    }
+    const auto nboxes = static_cast<int>(a_grids[lev].size());
+    a_pmaps[lev].resize(nboxes);
+    Vector<int> order(nboxes);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+      return a_costs[lev][a] > a_costs[lev][b];
+    });
+    for (const int i : order) {
+      const Real cost = a_costs[lev][i];
+      int rank = -1;
+      if (lev > 0) {
+        // Keep the fine box with its coarse data to limit the
+        // inter-level communications
+        const Box cbox = amrex::coarsen(a_grids[lev][i], a_refRatio[lev - 1]);
+        Long maxOverlap = 0;
+        for (const auto& isect : a_grids[lev - 1].intersections(cbox)) {
+          if (isect.second.numPts() > maxOverlap) {
+            maxOverlap = isect.second.numPts();
+            rank = a_pmaps[lev - 1][isect.first];
+          }
+        }
+        if (rank >= 0 && loads[rank] + cost > target) {
+          rank = -1;
+        }
+      }
+      if (rank < 0) {
+        rank = static_cast<int>(
+          std::min_element(loads.begin(), loads.end()) - loads.begin());
+      }
+      a_pmaps[lev][i] = rank;
+      loads[rank] += cost;
+    }
+  }
+
+  const Real maxLoad = *std::max_element(loads.begin(), loads.end());
+  return (maxLoad > 0.0) ? totalCost / (static_cast<Real>(nprocs) * maxLoad)
+                         : 1.0;
+}
+} // namespace
+
+void
+PeleLM::regridComposite(amrex::Real time)
+{
+  BL_PROFILE("PeleLMeX::regridComposite()");
+
+  // Get the new grids
+  int new_finest = 0;
+  Vector<BoxArray> new_grids(finest_level + 2);
+  if (m_lookaheadValid != 0) {
+    if (m_verbose > 1) {
+      Print() << " Using lookahead grids\n";
+    }
+    new_finest = m_lookaheadFinest;
+    new_grids = std::move(m_lookaheadGrids);
+    m_lookaheadValid = 0;
+  } else if (max_level > 0) {
+    const Real t0 = m_regridReport.start();
+    MakeNewGrids(0, time, new_finest, new_grids);
+    m_regridReport.stop(RegridReport::MakeNewGrids, t0);
+  }
+  BL_ASSERT(new_finest <= finest_level + 1);
+  new_grids[0] = grids[0];
+  new_grids.resize(new_finest + 1);
+
+  if (m_verbose > 0) {
+    Print() << " Composite load balancing of levels 0 to " << new_finest
+            << "\n";
+  }
+
+  // Per-box costs on the new grids, on all the ranks
+  Vector<Vector<Real>> costs(new_finest + 1);
+  Vector<int> ba_changed(new_finest + 1, 1);
+  for (int lev = 0; lev <= new_finest; ++lev) {
+    if (lev <= finest_level && new_grids[lev] == grids[lev]) {
+      ba_changed[lev] = 0;
+      computeCosts(lev);
+      gatherCostsToAll(*m_costs[lev], costs[lev]);
+    } else if (lev <= finest_level) {
+      LayoutData<Real> new_cost(
+        new_grids[lev], DistributionMapping(new_grids[lev]));
+      computeCosts(lev, new_cost, m_loadBalanceCost);
+      gatherCostsToAll(new_cost, costs[lev]);
+    } else {
+      // No data on a new level: use the coarse level cost per cell since
+      // all the levels advance with the same time step
+      Real crseCost = 0.0;
+      for (const auto& c : costs[lev - 1]) {
+        crseCost += c;
+      }
+      const Real costPerCell =
+        crseCost / static_cast<Real>(new_grids[lev - 1].numPts());
+      costs[lev].resize(new_grids[lev].size());
+      for (int i = 0; i < new_grids[lev].size(); ++i) {
+        costs[lev][i] =
+          costPerCell * static_cast<Real>(new_grids[lev][i].numPts());
+      }
+    }
+  }
+
+  // Test distribution: all the levels are redistributed
+  Vector<Vector<int>> test_pmaps(new_finest + 1);
+  const Real testEfficiency = compositeDistribute(
+    new_grids, costs, ref_ratio, m_loadBalanceCompositeTol, test_pmaps);
+
+  // Reference distribution: unchanged levels keep their current mapping
+  Vector<Vector<int>> ref_pmaps(new_finest + 1);
+  for (int lev = 0; lev <= new_finest; ++lev) {
+    if (ba_changed[lev] == 0) {
+      ref_pmaps[lev] = dmap[lev].ProcessorMap();
+    }
+  }
+  const Real refEfficiency = compositeDistribute(
+    new_grids, costs, ref_ratio, m_loadBalanceCompositeTol, ref_pmaps);
+
+  const bool useTest =
+    (m_loadBalanceEffRatioThreshold > 0.0) &&
+    (testEfficiency > m_loadBalanceEffRatioThreshold * refEfficiency);
+
+  if (m_verbose > 1) {
+    Print() << " Current LoadBalancing efficiency: " << refEfficiency << "\n"
+            << " Test LoadBalancing efficiency: " << testEfficiency << " \n";
+  }
+
+  // Remake/make the levels from coarse to fine
+  const auto& new_pmaps = useTest ? test_pmaps : ref_pmaps;
+  for (int lev = 0; lev <= new_finest; ++lev) {
+    if (lev <= finest_level) {
+      if (ba_changed[lev] == 0 && new_pmaps[lev] == dmap[lev].ProcessorMap()) {
+        continue;
+      }
+      DistributionMapping new_dmap(new_pmaps[lev]);
+      const auto old_num_setdm = num_setdm;
+      RemakeLevel(lev, time, new_grids[lev], new_dmap);
+      SetBoxArray(lev, new_grids[lev]);
+      if (old_num_setdm == num_setdm) {
+        SetDistributionMap(lev, new_dmap);
+      }
+    } else {
+      DistributionMapping new_dmap(new_pmaps[lev]);
+      const auto old_num_setdm = num_setdm;
+      MakeNewLevelFromCoarse(lev, time, new_grids[lev], new_dmap);
+      SetBoxArray(lev, new_grids[lev]);
+      if (old_num_setdm == num_setdm) {
+        SetDistributionMap(lev, new_dmap);
+      }
+    }
+  }
+
+  for (int lev = new_finest + 1; lev <= finest_level; ++lev) {
+    ClearLevel(lev);
+    ClearBoxArray(lev);
+    ClearDistributionMap(lev);
+  }
+
+  finest_level = new_finest;
+
+#ifdef PELE_USE_RADIATION
+  if (do_rad_solve) {
+#ifdef AMREX_USE_EB
+    rad_model->initVars(grids, dmap, m_factory);
+#else
+    rad_model->initVars(grids, dmap);
+#endif
+  }
+#endif
+}
+
+void
+PeleLM::computeLookaheadGrids(amrex::Real time)
+{
+  BL_PROFILE("PeleLMeX::computeLookaheadGrids()");
+
+  if (max_level == 0 || !m_regrid_file.empty()) {
+    return;
+  }
+
+  if (m_verbose > 0) {
+    Print() << " Computing lookahead grids...\n";
+  }
+
+  // With CFL < 1, features travel less than a cell per step on any level:
+  // widen the tagging buffer by one cell to cover the lag
+  const Vector<IntVect> n_error_buf_save = n_error_buf;
+  for (auto& buf : n_error_buf) {
+    buf += IntVect(1);
+  }
+  if (m_autoMaxGridSize != 0) {
+    tuneMaxGridSize();
+  }
+  m_lookaheadGrids.clear();
+  m_lookaheadGrids.resize(finest_level + 2);
+  const Real t0 = m_regridReport.start();
+  MakeNewGrids(0, time, m_lookaheadFinest, m_lookaheadGrids);
+  m_regridReport.stop(RegridReport::MakeNewGrids, t0);
+  n_error_buf = n_error_buf_save;
+  m_lookaheadValid = 1;
+}
+
+void
+PeleLM::tuneMaxGridSize()
+{
+  BL_PROFILE("PeleLMeX::tuneMaxGridSize()");
+
+  if (m_verbose > 0 && m_autoStepCount > 0) {
+    Print() << " Average step time with the current decomposition: "
+            << m_autoStepTime / static_cast<Real>(m_autoStepCount) << " over "
+            << m_autoStepCount << " steps\n";
+  }
+  m_autoStepTime = 0.0;
+  m_autoStepCount = 0;
+
+  const auto nprocs = static_cast<Real>(ParallelDescriptor::NProcs());
+  const auto nthreads = static_cast<Real>(OpenMP::get_max_threads());
+  const IntVect tile = FabArrayBase::mfiter_tile_size;
+  const auto tileCells =
+    static_cast<Real>(AMREX_D_TERM(tile[0], *tile[1], *tile[2]));
+
+  // Only the existing levels have a cell count to work from
+  for (int lev = 1; lev <= finest_level; ++lev) {
+
+    // Per-box cost model: a + b * (cells incl. ghost cells), the overhead
+    // a/b is fitted on the measured box costs when available
+    Real overhead = m_autoMaxGridSizeOverhead;
+    bool fitted = false;
+    LayoutData<Real> levCosts(grids[lev], dmap[lev]);
+    if (m_costMeasure.getCosts(lev, levCosts)) {
+      Vector<Real> costs;
+      gatherCostsToAll(levCosts, costs);
+      const auto n = static_cast<Real>(costs.size());
+      Real sx = 0.0;
+      Real sy = 0.0;
+      Real sxx = 0.0;
+      Real sxy = 0.0;
+      for (int i = 0; i < costs.size(); ++i) {
+        const auto x =
+          static_cast<Real>(amrex::grow(grids[lev][i], m_nGrowState).numPts());
+        sx += x;
+        sy += costs[i];
+        sxx += x * x;
+        sxy += x * costs[i];
+      }
+      const Real det = n * sxx - sx * sx;
+      if (det > 0.0) {
+        const Real b = (n * sxy - sx * sy) / det;
+        const Real a = (sy - b * sx) / n;
+        if (a > 0.0 && b > 0.0) {
+          overhead = a / b;
+          fitted = true;
+        }
+      }
+    }
+
+    // Candidate sizes: multiples of the blocking factor, up to the domain
+    const IntVect& bf = blocking_factor[lev];
+    const int bfmax = bf.max();
+    const int mmax =
+      std::min(m_autoMaxGridSizeMax, geom[lev].Domain().longside());
+    const auto levCells = static_cast<Real>(grids[lev].d_numPts());
+    int bestSize = max_grid_size[lev].max();
+    Real bestCost = std::numeric_limits<Real>::max();
+    Real bestBoxes = 0.0;
+    for (int m = bfmax; m <= std::max(mmax, bfmax); m += bfmax) {
+      bool valid = true;
+      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        valid = valid && (m % bf[idim] == 0);
+      }
+      if (!valid) {
+        continue;
+      }
+      const Real boxCells = std::pow(static_cast<Real>(m), AMREX_SPACEDIM);
+      const Real grownCells =
+        std::pow(static_cast<Real>(m + 2 * m_nGrowState), AMREX_SPACEDIM);
+      const Real nboxes = std::max(1.0, std::ceil(levCells / boxCells));
+      // Critical path: boxes of the most loaded rank, with the threads
+      // starved when the rank has fewer tiles than threads
+      const Real boxesPerRank = std::ceil(nboxes / nprocs);
+      const Real ntiles =
+        boxesPerRank * std::max(1.0, std::ceil(boxCells / tileCells));
+      const Real threadFactor = nthreads / std::min(nthreads, ntiles);
+      const Real cost = boxesPerRank * (overhead + grownCells * threadFactor);
+      // Ties favor the larger boxes, with less communications
+      if (cost <= bestCost) {
+        bestCost = cost;
+        bestSize = m;
+        bestBoxes = nboxes;
+      }
+    }
+
+    if (m_verbose > 0) {
+      Print() << " Level " << lev
+              << " max_grid_size: " << max_grid_size[lev].max() << " -> "
+              << bestSize << " (~" << bestBoxes << " boxes, "
+              << bestBoxes / nprocs << " per rank, box overhead " << overhead
+              << " cells" << (fitted ? ", measured" : "") << ")\n";
+    }
+    max_grid_size[lev] = IntVect(bestSize);
+  }
+}
+
+Vector<Real>
+PeleLM::getLayoutEfficiency()
+{
+  BL_PROFILE("PeleLMeX::getLayoutEfficiency()");
+
+  const int nprocs = ParallelDescriptor::NProcs();
+  Vector<Real> eff(max_level + 1, -1.0);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    LayoutData<Real> costs(grids[lev], dmap[lev]);
+    if (!m_costMeasure.getCosts(lev, costs)) {
+      for (MFIter mfi(costs, false); mfi.isValid(); ++mfi) {
+        costs[mfi] = static_cast<Real>(mfi.validbox().numPts());
+      }
+    }
+    Vector<Real> loads(nprocs, 0.0);
+    for (MFIter mfi(costs, false); mfi.isValid(); ++mfi) {
+      loads[ParallelDescriptor::MyProc()] += costs[mfi];
+    }
+    ParallelDescriptor::ReduceRealSum(loads.data(), nprocs);
+    const Real maxLoad = *std::max_element(loads.begin(), loads.end());
+    const Real totalLoad = std::accumulate(loads.begin(), loads.end(), 0.0);
+    eff[lev] =
+      (maxLoad > 0.0) ? totalLoad / (static_cast<Real>(nprocs) * maxLoad) : 1.0;
+  }
+  return eff;
+}
+
 void
 PeleLM::MakeNewLevelFromCoarse(
   int lev,
@@ -309,6 +714,10 @@ PeleLM::MakeNewLevelFromCoarse(
   const amrex::DistributionMapping& dm)
 {
   BL_PROFILE("PeleLMeX::MakeNewLevelFromCoarse()");
+  const Real t0 = m_regridReport.start();
+
+  // Pooled MFs no longer match the level grids
+  m_mfPool.clearLevel(lev);
 
   if (m_verbose > 0) {
     Print() << " Making new level " << lev << " from coarse\n";
@@ -328,17 +737,14 @@ PeleLM::MakeNewLevelFromCoarse(
   }
 
   // New level factory
-#ifdef AMREX_USE_EB
   std::unique_ptr<FabFactory<FArrayBox>> new_fact =
-    makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
-#else
-  std::unique_ptr<FabFactory<FArrayBox>> new_fact(new FArrayBoxFactory());
-#endif
+    makeLevelFactory(lev, ba, dm);
 
   // New leveldatas
   std::unique_ptr<LevelData> n_leveldata_old(new LevelData(
     ba, dm, *new_fact, m_incompressible, m_has_divu, m_nAux, m_nGrowState,
-    m_use_soret, static_cast<int>(m_do_les)));
+    m_use_soret, static_cast<int>(m_do_les),
+    static_cast<int>(m_lowMemTransport == 0)));
 
   std::unique_ptr<LevelData> n_leveldata_new(new LevelData(
     ba, dm, *new_fact, m_incompressible, m_has_divu, m_nAux, m_nGrowState,
@@ -358,6 +764,8 @@ PeleLM::MakeNewLevelFromCoarse(
   // Move std::unique_ptr into the PeleLM vector
   m_leveldata_old[lev] = std::move(n_leveldata_old);
   m_leveldata_new[lev] = std::move(n_leveldata_new);
+  shareDiffusivity(lev);
+  retireLevelFactory(lev);
   m_factory[lev] = std::move(new_fact);
 
   if (m_do_react != 0) {
@@ -390,6 +798,8 @@ PeleLM::MakeNewLevelFromCoarse(
 #ifdef PELE_USE_EFIELD
   m_leveldatanlsolve[lev].reset(
     new LevelDataNLSolve(ba, dm, *m_factory[lev], m_nGrowState));
+  m_ef_nlBackValid = 0;
+  m_ef_nlSDCValid = 0;
   if (m_do_extraEFdiags) {
     m_ionsFluxes[lev].reset(new MultiFab(ba, dm, NUM_IONS * AMREX_SPACEDIM, 0));
   }
@@ -398,6 +808,7 @@ PeleLM::MakeNewLevelFromCoarse(
 
   // Load balance
   m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
+  m_costMeasure.defineLevel(lev, ba, dm);
 
   // DiffusionOp will be recreated
   m_diffusion_op.reset();
@@ -410,6 +821,8 @@ PeleLM::MakeNewLevelFromCoarse(
     ba, dm, NVAR, amrex::max(m_nGrowAdv, m_nGrowMAC), MFInfo(),
     *m_factory[lev]);
   m_extSource[lev]->setVal(0.);
+
+  m_regridReport.stop(RegridReport::MakeNewLevel, t0);
 }
 
 void
@@ -420,6 +833,10 @@ PeleLM::RemakeLevel(
   const amrex::DistributionMapping& dm)
 {
   BL_PROFILE("PeleLMeX::RemakeLevel()");
+  const Real t0 = m_regridReport.start();
+
+  // Pooled MFs no longer match the level grids
+  m_mfPool.clearLevel(lev);
 
   if (m_verbose > 0) {
     Print() << " Remaking level " << lev << "\n";
@@ -439,42 +856,82 @@ PeleLM::RemakeLevel(
   }
 
   // New level factory
-#ifdef AMREX_USE_EB
   std::unique_ptr<FabFactory<FArrayBox>> new_fact =
-    makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
-#else
-  std::unique_ptr<FabFactory<FArrayBox>> new_fact(new FArrayBoxFactory());
-#endif
+    makeLevelFactory(lev, ba, dm);
 
   // New leveldatas
   std::unique_ptr<LevelData> n_leveldata_old(new LevelData(
     ba, dm, *new_fact, m_incompressible, m_has_divu, m_nAux, m_nGrowState,
-    m_use_soret, static_cast<int>(m_do_les)));
+    m_use_soret, static_cast<int>(m_do_les),
+    static_cast<int>(m_lowMemTransport == 0)));
 
   std::unique_ptr<LevelData> n_leveldata_new(new LevelData(
     ba, dm, *new_fact, m_incompressible, m_has_divu, m_nAux, m_nGrowState,
     m_use_soret, static_cast<int>(m_do_les)));
 
+  // Boxes unchanged and kept on the same rank are copied from the current
+  // level data, only the other boxes are fillpatched
+  RegridReuse reuse;
+  if (m_incrementalRegrid != 0) {
+    reuse = findReusableBoxes(lev, ba, dm);
+    if (m_verbose > 1) {
+      Print() << " Reusing " << reuse.nReused << " out of " << ba.size()
+              << " boxes on level " << lev << "\n";
+    }
+  }
+  const bool incremental = reuse.nReused > 0;
+
   // Fill the leveldata_new
-  fillpatch_state(lev, time, n_leveldata_new->state, m_nGrowState);
-  fillpatch_gradp(lev, time, n_leveldata_new->gp, 0);
+  if (incremental) {
+    fillpatchIncremental(
+      lev, time, reuse, m_leveldata_new[lev]->state, n_leveldata_new->state,
+      &PeleLM::fillpatch_state);
+    fillpatchIncremental(
+      lev, time, reuse, m_leveldata_new[lev]->gp, n_leveldata_new->gp,
+      &PeleLM::fillpatch_gradp);
+  } else {
+    fillpatch_state(lev, time, n_leveldata_new->state, m_nGrowState);
+    fillpatch_gradp(lev, time, n_leveldata_new->gp, 0);
+  }
   n_leveldata_new->press.setVal(0.0);
 
   if (m_incompressible == 0) {
     if (m_has_divu != 0) {
-      fillpatch_divu(lev, time, n_leveldata_new->divu, 1);
+      if (incremental) {
+        fillpatchIncremental(
+          lev, time, reuse, m_leveldata_new[lev]->divu, n_leveldata_new->divu,
+          &PeleLM::fillpatch_divu);
+      } else {
+        fillpatch_divu(lev, time, n_leveldata_new->divu, 1);
+      }
     }
   }
 
   // Move std::unique_ptr into the PeleLM vector
   m_leveldata_old[lev] = std::move(n_leveldata_old);
   m_leveldata_new[lev] = std::move(n_leveldata_new);
+  shareDiffusivity(lev);
+  retireLevelFactory(lev);
   m_factory[lev] = std::move(new_fact);
 
+  // Valid data now in place, fill the ghost cells
+  if (incremental) {
+    fillpatch_state(lev, time, m_leveldata_new[lev]->state, m_nGrowState);
+    if (m_incompressible == 0 && m_has_divu != 0) {
+      fillpatch_divu(lev, time, m_leveldata_new[lev]->divu, 1);
+    }
+  }
+
   if (m_do_react != 0) {
     std::unique_ptr<LevelDataReact> n_leveldatareact(
       new LevelDataReact(ba, dm, *m_factory[lev]));
-    fillpatch_reaction(lev, time, n_leveldatareact->I_R, 0);
+    if (incremental) {
+      fillpatchIncremental(
+        lev, time, reuse, m_leveldatareact[lev]->I_R, n_leveldatareact->I_R,
+        &PeleLM::fillpatch_reaction);
+    } else {
+      fillpatch_reaction(lev, time, n_leveldatareact->I_R, 0);
+    }
     n_leveldatareact->functC.setVal(0.0);
     m_leveldatareact[lev] = std::move(n_leveldatareact);
   }
@@ -501,6 +958,8 @@ PeleLM::RemakeLevel(
 #ifdef PELE_USE_EFIELD
   m_leveldatanlsolve[lev].reset(
     new LevelDataNLSolve(ba, dm, *m_factory[lev], m_nGrowState));
+  m_ef_nlBackValid = 0;
+  m_ef_nlSDCValid = 0;
   if (m_do_extraEFdiags) {
     m_ionsFluxes[lev].reset(new MultiFab(ba, dm, NUM_IONS * AMREX_SPACEDIM, 0));
   }
@@ -509,6 +968,7 @@ PeleLM::RemakeLevel(
 
   // Load balance
   m_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
+  m_costMeasure.remapLevel(lev, ba, dm);
 
   // DiffusionOp will be recreated
   m_diffusion_op.reset();
@@ -521,6 +981,156 @@ PeleLM::RemakeLevel(
     ba, dm, NVAR, amrex::max(m_nGrowAdv, m_nGrowMAC), MFInfo(),
     *m_factory[lev]);
   m_extSource[lev]->setVal(0.);
+
+  m_regridReport.stop(RegridReport::RemakeLevel, t0);
+}
+
+PeleLM::RegridReuse
+PeleLM::findReusableBoxes(
+  int lev, const BoxArray& ba, const DistributionMapping& dm)
+{
+  BL_PROFILE("PeleLMeX::findReusableBoxes()");
+
+  // Every rank holds the full BoxArrays and DistributionMappings: the
+  // result is identical on all ranks without communication
+  const BoxArray& cur_ba = grids[lev];
+  const DistributionMapping& cur_dm = dmap[lev];
+  const int nboxes = static_cast<int>(ba.size());
+
+  RegridReuse reuse;
+  reuse.srcIdx.resize(nboxes, -1);
+  reuse.fillIdx.resize(nboxes, -1);
+  Vector<Box> fillBoxes;
+  Vector<int> fillRanks;
+  for (int i = 0; i < nboxes; ++i) {
+    const Box& bx = ba[i];
+    for (const auto& isect : cur_ba.intersections(bx)) {
+      if (cur_ba[isect.first] == bx && cur_dm[isect.first] == dm[i]) {
+        reuse.srcIdx[i] = isect.first;
+        break;
+      }
+    }
+    if (reuse.srcIdx[i] >= 0) {
+      reuse.nReused += 1;
+    } else {
+      reuse.fillIdx[i] = static_cast<int>(fillBoxes.size());
+      fillBoxes.push_back(bx);
+      fillRanks.push_back(dm[i]);
+    }
+  }
+
+  if (!fillBoxes.empty()) {
+    reuse.baFill =
+      BoxArray(fillBoxes.data(), static_cast<int>(fillBoxes.size()));
+    reuse.dmFill = DistributionMapping(std::move(fillRanks));
+  }
+  return reuse;
+}
+
+void
+PeleLM::fillpatchIncremental(
+  int lev,
+  Real a_time,
+  const RegridReuse& a_reuse,
+  const MultiFab& a_cur,
+  MultiFab& a_mf,
+  FillPatchFunc a_fill)
+{
+  BL_PROFILE("PeleLMeX::fillpatchIncremental()");
+
+  const int ncomp = a_mf.nComp();
+
+  // Fillpatch the valid region of the new boxes only
+  MultiFab fillMF;
+  if (!a_reuse.baFill.empty()) {
+    fillMF.define(a_reuse.baFill, a_reuse.dmFill, ncomp, 0);
+    (this->*a_fill)(lev, a_time, fillMF, 0);
+  }
+
+  // Both the reused and the fillpatched boxes are local: plain copies
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(a_mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.tilebox();
+    const int idx = mfi.index();
+    auto const& dst = a_mf.array(mfi);
+    auto const& src = (a_reuse.srcIdx[idx] >= 0)
+                        ? a_cur.const_array(a_reuse.srcIdx[idx])
+                        : fillMF.const_array(a_reuse.fillIdx[idx]);
+    amrex::ParallelFor(
+      bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+        dst(i, j, k, n) = src(i, j, k, n);
+      });
+  }
+  Gpu::streamSynchronize();
+}
+
+std::unique_ptr<FabFactory<FArrayBox>>
+PeleLM::makeLevelFactory(
+  int lev, const BoxArray& ba, const DistributionMapping& dm)
+{
+#ifdef AMREX_USE_EB
+  BL_PROFILE("PeleLMeX::makeLevelFactory()");
+
+  auto sameLayout = [&ba, &dm](const FabFactory<FArrayBox>& a_fact) {
+    const auto& flags =
+      static_cast<const EBFArrayBoxFactory&>(a_fact).getMultiEBCellFlagFab();
+    return flags.boxArray() == ba && flags.DistributionMap() == dm;
+  };
+
+  // Current factory of the level, e.g. level remade following a change
+  // of the coarser level only
+  if (m_factory[lev] != nullptr && sameLayout(*m_factory[lev])) {
+    if (m_verbose > 2) {
+      Print() << " Reusing current EB factory on level " << lev << "\n";
+    }
+    return std::unique_ptr<FabFactory<FArrayBox>>(m_factory[lev]->clone());
+  }
+
+  // Recently used layouts
+  for (const auto& fact : m_EBFactoryCache[lev]) {
+    if (sameLayout(*fact)) {
+      if (m_verbose > 2) {
+        Print() << " Reusing cached EB factory on level " << lev << "\n";
+      }
+      return std::unique_ptr<FabFactory<FArrayBox>>(fact->clone());
+    }
+  }
+
+  return makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
+#else
+  amrex::ignore_unused(lev, ba, dm);
+  return std::make_unique<FArrayBoxFactory>();
+#endif
+}
+
+void
+PeleLM::retireLevelFactory(int lev)
+{
+#ifdef AMREX_USE_EB
+  if (m_EBFactoryCacheSize <= 0 || m_factory[lev] == nullptr) {
+    return;
+  }
+  const auto& cur_flags = EBFactory(lev).getMultiEBCellFlagFab();
+  auto& cache = m_EBFactoryCache[lev];
+  for (const auto& fact : cache) {
+    const auto& flags =
+      static_cast<const EBFArrayBoxFactory&>(*fact).getMultiEBCellFlagFab();
+    if (
+      flags.boxArray() == cur_flags.boxArray() &&
+      flags.DistributionMap() == cur_flags.DistributionMap()) {
+      return;
+    }
+  }
+  // Shallow copy: the EB data is shared with the level MultiFabs
+  cache.emplace_back(m_factory[lev]->clone());
+  if (static_cast<int>(cache.size()) > m_EBFactoryCacheSize) {
+    cache.erase(cache.begin());
+  }
+#else
+  amrex::ignore_unused(lev);
+#endif
 }
 
 void
@@ -528,6 +1138,9 @@ PeleLM::ClearLevel(int lev)
 {
   BL_PROFILE("PeleLMeX::ClearLevel()");
 
+  // Pooled MFs no longer match the level grids
+  m_mfPool.clearLevel(lev);
+
   m_leveldata_old[lev].reset();
   m_leveldata_new[lev].reset();
   if (m_do_react != 0) {
@@ -538,6 +1151,7 @@ PeleLM::ClearLevel(int lev)
   }
   m_baChem[lev].reset();
   m_dmapChem[lev].reset();
+  retireLevelFactory(lev);
   m_factory[lev].reset();
   m_diffusion_op.reset();
   m_mcdiffusion_op.reset();
@@ -550,9 +1164,12 @@ PeleLM::ClearLevel(int lev)
   }
 #endif
   m_extSource[lev]->clear();
+  m_diffRefState[lev].reset();
+  m_viscRefState[lev].reset();
 
   m_costs[lev].reset();
   m_loadBalanceEff[lev] = -1.0;
+  m_costMeasure.clearLevel(lev);
 }
 
 void
@@ -600,6 +1217,11 @@ PeleLM::computeCosts(int a_lev, LayoutData<Real>& a_costs, int a_costMethod)
     for (MFIter mfi(costMF, false); mfi.isValid(); ++mfi) {
       a_costs[mfi] = costMF[mfi].sum<RunOn::Device>(mfi.validbox(), 0);
     }
+  } else if (a_costMethod == LoadBalanceCost::Measured) {
+    // Fall back to the number of cells until something is measured
+    if (!m_costMeasure.getCosts(a_lev, a_costs)) {
+      computeCosts(a_lev, a_costs, LoadBalanceCost::Ncell);
+    }
   } else {
     Abort(" Unknown cost estimate method !");
   }
@@ -0,0 +1,139 @@
+#include <PeleLMeX_RegridReport.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+#include <algorithm>
+#include <fstream>
+
+using namespace amrex;
+
+void
+RegridReport::define(const std::string& a_file)
+{
+  m_file = a_file;
+  m_active = !m_file.empty();
+  m_phaseTimes.fill(0.0);
+  if (m_active && ParallelDescriptor::IOProcessor()) {
+    // Only write the header in a new (or empty) file: a restart appends
+    // to the report of the previous run
+    bool newFile = true;
+    {
+      std::ifstream existingFile(m_file.c_str());
+      newFile = !existingFile.good() ||
+                existingFile.peek() == std::ifstream::traits_type::eof();
+    }
+    if (newFile) {
+      std::ofstream reportFile(
+        m_file.c_str(), std::ofstream::out | std::ofstream::app);
+      reportFile << "iter,time,level,oldBoxes,newBoxes,oldCells,newCells,"
+                    "movedCells,interpCells,movedBytes,effBefore,effAfter,"
+                    "tErrorEst,tMakeNewGrids,tRemakeLevel,tMakeNewLevel,"
+                    "tResetCoveredMask,tResetMacProjector,tTotal\n";
+    }
+  }
+}
+
+Real
+RegridReport::start() const
+{
+  if (!m_active) {
+    return 0.0;
+  }
+  return ParallelDescriptor::second();
+}
+
+void
+RegridReport::stop(int a_phase, Real a_t0)
+{
+  if (!m_active) {
+    return;
+  }
+  m_phaseTimes[a_phase] += ParallelDescriptor::second() - a_t0;
+}
+
+void
+RegridReport::begin(
+  const Vector<BoxArray>& a_grids,
+  const Vector<DistributionMapping>& a_dmap,
+  const Vector<Real>& a_eff)
+{
+  if (!m_active) {
+    return;
+  }
+  m_startTime = ParallelDescriptor::second();
+  m_oldGrids = a_grids;
+  m_oldDmap = a_dmap;
+  m_oldEff = a_eff;
+}
+
+void
+RegridReport::end(
+  int a_step,
+  Real a_time,
+  const Vector<BoxArray>& a_grids,
+  const Vector<DistributionMapping>& a_dmap,
+  const Vector<Real>& a_eff,
+  Long a_bytesPerCell)
+{
+  if (!m_active) {
+    return;
+  }
+
+  // Slowest rank of each phase
+  Real totalTime = ParallelDescriptor::second() - m_startTime;
+  const int ioproc = ParallelDescriptor::IOProcessorNumber();
+  ParallelDescriptor::ReduceRealMax(m_phaseTimes.data(), NPhases, ioproc);
+  ParallelDescriptor::ReduceRealMax(totalTime, ioproc);
+
+  if (ParallelDescriptor::IOProcessor()) {
+    std::ofstream reportFile(
+      m_file.c_str(), std::ofstream::out | std::ofstream::app);
+    reportFile.precision(8);
+    const auto nlevs =
+      static_cast<int>(std::max(a_grids.size(), m_oldGrids.size()));
+    for (int lev = 0; lev < nlevs; ++lev) {
+      const bool hasOld = lev < m_oldGrids.size() && !m_oldGrids[lev].empty();
+      const bool hasNew = lev < a_grids.size() && !a_grids[lev].empty();
+      if (!hasOld && !hasNew) {
+        continue;
+      }
+
+      // New cells owned by another rank on the old grids are moved, new
+      // cells not covered by the old grids are interpolated
+      Long movedCells = 0;
+      Long interpCells = 0;
+      if (hasNew) {
+        for (int i = 0; i < a_grids[lev].size(); ++i) {
+          Long coveredCells = 0;
+          if (hasOld) {
+            for (const auto& is :
+                 m_oldGrids[lev].intersections(a_grids[lev][i])) {
+              coveredCells += is.second.numPts();
+              if (m_oldDmap[lev][is.first] != a_dmap[lev][i]) {
+                movedCells += is.second.numPts();
+              }
+            }
+          }
+          interpCells += a_grids[lev][i].numPts() - coveredCells;
+        }
+      }
+
+      reportFile << a_step << "," << a_time << "," << lev << ","
+                 << (hasOld ? m_oldGrids[lev].size() : 0) << ","
+                 << (hasNew ? a_grids[lev].size() : 0) << ","
+                 << (hasOld ? m_oldGrids[lev].numPts() : 0) << ","
+                 << (hasNew ? a_grids[lev].numPts() : 0) << "," << movedCells
+                 << "," << interpCells << "," << movedCells * a_bytesPerCell
+                 << "," << (hasOld ? m_oldEff[lev] : -1.0) << ","
+                 << (hasNew ? a_eff[lev] : -1.0);
+      for (const auto& t : m_phaseTimes) {
+        reportFile << "," << t;
+      }
+      reportFile << "," << totalTime << "\n";
+    }
+  }
+
+  m_phaseTimes.fill(0.0);
+  m_oldGrids.clear();
+  m_oldDmap.clear();
+  m_oldEff.clear();
+}
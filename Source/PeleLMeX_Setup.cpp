@@ -132,6 +132,40 @@ PeleLM::Setup()
         }
       }
     }
+    if (m_useTransportTable != 0 || m_multiCompDiff != 0) {
+      Real tableStart = ParallelDescriptor::second();
+      m_transportTable.define(
+        m_transportTableTmin, m_transportTableTmax, m_transportTabledT,
+        trans_parms.device_parm());
+      if (m_verbose != 0 && m_multiCompDiff != 0) {
+        amrex::Print() << "    Using multi-component diffusion with tabulated "
+                          "binary coefficients"
+                       << std::endl;
+      }
+      if (m_verbose != 0) {
+        amrex::Print() << ((m_useTransportTable != 0)
+                             ? "    Using tabulated transport on ["
+                             : "    Binary diffusion table on [")
+                       << m_transportTableTmin << ", " << m_transportTableTmax
+                       << "] K, dT = " << m_transportTabledT << " K ("
+                       << m_transportTable.nBytes() / (1024 * 1024)
+                       << " MB, built in "
+                       << ParallelDescriptor::second() - tableStart << " s)"
+                       << std::endl;
+      }
+    }
+    if (m_useThermoSoA != 0) {
+      if (!m_thermoSoA.define(200.0, 4000.0, 1.0e-10)) {
+        amrex::Print() << " WARNING: thermo_soa could not recover the species "
+                          "polynomials (max. error "
+                       << m_thermoSoA.maxError() << "), deactivating it\n";
+        m_useThermoSoA = 0;
+      } else if (m_verbose != 0) {
+        amrex::Print() << "    Using strip evaluation of the thermodynamics"
+                       << " (max. error " << m_thermoSoA.maxError() << ")"
+                       << std::endl;
+      }
+    }
     if (m_do_react != 0) {
       int reactor_type = 2;
       int ncells_chem = 1;
@@ -448,11 +482,82 @@ PeleLM::readParameters()
                       "fixed_Pr or fixed_Le is true"
                    << std::endl;
   }
+  pp.query("low_memory_transport", m_lowMemTransport);
+  pp.query("fused_species_flux_correction", m_fusedSpeciesFluxCorr);
+  pp.query("fused_divu", m_fusedDivU);
+  pp.query("lagged_transport_tol", m_laggedTransportTol);
+  pp.query("transport_table", m_useTransportTable);
+  pp.query("transport_table_Tmin", m_transportTableTmin);
+  pp.query("transport_table_Tmax", m_transportTableTmax);
+  pp.query("transport_table_dT", m_transportTabledT);
+  // The table only holds the mixture-averaged model pure species properties
+  if (
+    m_useTransportTable != 0 &&
+    (m_fixed_Le != 0 || m_fixed_Pr != 0 || m_use_soret != 0 || m_do_les)) {
+    amrex::Print() << " WARNING: transport_table only available with the "
+                      "mixture-averaged model without Soret effects, "
+                      "deactivating it\n";
+    m_useTransportTable = 0;
+  }
+  pp.query("multicomponent_diffusion", m_multiCompDiff);
+  pp.query("mc_diffusion_max_iter", m_mcDiffMaxIter);
+  pp.query("mc_diffusion_tol", m_mcDiffTol);
+  pp.query("mc_diffusion_verbose", m_mcDiffVerbose);
+  // The binary diffusion coefficients are extracted from the
+  // mixture-averaged model
+  if (
+    m_multiCompDiff != 0 &&
+    (m_fixed_Le != 0 || m_fixed_Pr != 0 || m_use_soret != 0 || m_do_les)) {
+    amrex::Print() << " WARNING: multicomponent_diffusion only available "
+                      "with the mixture-averaged model without Soret "
+                      "effects, deactivating it\n";
+    m_multiCompDiff = 0;
+  }
+#ifdef PELE_USE_EFIELD
+  if (m_multiCompDiff != 0) {
+    amrex::Print() << " WARNING: multicomponent_diffusion not available with "
+                      "the electric field, deactivating it\n";
+    m_multiCompDiff = 0;
+  }
+#endif
+  if (m_multiCompDiff != 0) {
+    // The non-Fickian fluxes replace the Wbar fluxes
+    m_use_wbar = 1;
+    m_mcDiffMaxIter = std::max(1, m_mcDiffMaxIter);
+  }
+  if (m_laggedTransportTol > 0.0 && m_lowMemTransport != 0) {
+    amrex::Print() << " WARNING: lagged_transport_tol not available with "
+                      "low_memory_transport, deactivating it\n";
+    m_laggedTransportTol = 0.0;
+  }
+#ifdef AMREX_USE_EB
+  // The EB flux correction relies on face centroid states
+  if (m_fusedSpeciesFluxCorr != 0) {
+    amrex::Print() << " WARNING: fused_species_flux_correction not available "
+                      "with EB, deactivating it\n";
+    m_fusedSpeciesFluxCorr = 0;
+  }
+  // The EB diffusion terms need to be redistributed
+  if (m_fusedDivU != 0) {
+    amrex::Print() << " WARNING: fused_divu not available with EB, "
+                      "deactivating it\n";
+    m_fusedDivU = 0;
+  }
+#endif
 
   pp.query("deltaT_verbose", m_deltaT_verbose);
   pp.query("deltaT_iterMax", m_deltaTIterMax);
   pp.query("deltaT_tol", m_deltaT_norm_max);
   pp.query("deltaT_crashIfFailing", m_crashOnDeltaTFail);
+  pp.query("deltaT_anderson_depth", m_deltaTAndersonDepth);
+  pp.query("thermo_soa", m_useThermoSoA);
+#ifdef AMREX_USE_GPU
+  if (m_useThermoSoA != 0) {
+    amrex::Print() << " WARNING: thermo_soa only available on CPU, "
+                      "deactivating it\n";
+    m_useThermoSoA = 0;
+  }
+#endif
 
   // -----------------------------------------
   // initialization
@@ -466,12 +571,27 @@ PeleLM::readParameters()
   // advance
   // -----------------------------------------
   pp.query("sdc_iterMax", m_nSDCmax);
+  pp.query("sdc_adaptive", m_sdcAdaptive);
+  pp.query("sdc_iterMin", m_sdcIterMin);
+  pp.query("sdc_tol", m_sdcTol);
+  if (m_sdcAdaptive != 0) {
+    if (m_nSDCmax < 2) {
+      amrex::Print() << " WARNING: sdc_adaptive requires sdc_iterMax > 1,"
+                     << " deactivating it\n";
+      m_sdcAdaptive = 0;
+    } else {
+      // The change is only available from the second iteration on
+      m_sdcIterMin = std::max(2, std::min(m_sdcIterMin, m_nSDCmax));
+    }
+  }
   m_print_chi_convergence = m_verbose > 1;
   pp.query("print_chi_convergence", m_print_chi_convergence);
   parseUserKey(pp, "chi_correction_type", chicorr, m_chi_correction_type);
   pp.query("floor_species", m_floor_species);
   pp.query("dPdt_factor", m_dpdtFactor);
   pp.query("memory_checks", m_checkMem);
+  pp.query("use_mf_pool", m_useMFPool);
+  m_mfPool.define(max_level + 1, m_useMFPool != 0);
   pp.query("divu_dt_factor", m_divu_dtFactor);
   pp.query("divu_dt_rhoMin", m_divu_rhoMin);
   pp.query("divu_dt_method", m_divu_checkFlag);
@@ -508,6 +628,30 @@ PeleLM::readParameters()
       Abort("peleLM.max_grid_size_chem should have 1 or AMREX_SPACEDIM values");
     }
   }
+  pp.query("chem_layout_all_levels", m_chemLayoutAllLevels);
+  pp.query("cache_reaction_terms", m_cacheReactionTerms);
+  pp.query("multi_rate", m_multiRate);
+  pp.query("multi_rate_tol", m_multiRateTol);
+#ifdef PELE_USE_EFIELD
+  if (m_multiRate != 0) {
+    amrex::Print() << " WARNING: multi_rate not available with "
+                      "the electric field, deactivating it\n";
+    m_multiRate = 0;
+  }
+#endif
+#ifdef PELE_USE_EFIELD
+  if (m_cacheReactionTerms != 0) {
+    amrex::Print() << " WARNING: cache_reaction_terms not available with "
+                      "the electric field, deactivating it\n";
+    m_cacheReactionTerms = 0;
+  }
+#endif
+  // Flooring the species after the chemistry invalidates the cached rates
+  if (m_cacheReactionTerms != 0 && m_floor_species != 0) {
+    amrex::Print() << " WARNING: cache_reaction_terms not available with "
+                      "floor_species, deactivating it\n";
+    m_cacheReactionTerms = 0;
+  }
 
   // -----------------------------------------
   // Load Balancing
@@ -521,6 +665,8 @@ PeleLM::readParameters()
     pp, "chem_load_balancing_method", lbmethod, m_loadBalanceMethodChem);
   parseUserKey(
     pp, "chem_load_balancing_cost_estimate", lbcost, m_loadBalanceCostChem);
+  pp.query("load_balancing_composite", m_loadBalanceComposite);
+  pp.query("load_balancing_composite_tol", m_loadBalanceCompositeTol);
 
   // Deactivate load balancing for serial runs
 #ifdef AMREX_USE_MPI
@@ -530,6 +676,20 @@ PeleLM::readParameters()
 #else
   m_doLoadBalance = 0;
 #endif
+  m_costMeasure.define(
+    max_level + 1, (m_doLoadBalance != 0) &&
+                     (m_loadBalanceCost == LoadBalanceCost::Measured ||
+                      m_loadBalanceCostChem == LoadBalanceCost::Measured));
+
+  pp.query("incremental_regrid", m_incrementalRegrid);
+#ifdef AMREX_USE_EB
+  // Fillpatching a subset of the boxes requires its own EB factory
+  if (m_incrementalRegrid != 0) {
+    amrex::Print() << " WARNING: incremental_regrid not available with EB, "
+                      "deactivating it\n";
+    m_incrementalRegrid = 0;
+  }
+#endif
 
   // -----------------------------------------
   // Advection
@@ -568,6 +728,15 @@ PeleLM::readParameters()
   m_predict_advection_type =
     "Godunov"; // Only option at this point. This will disappear when
                // predict_velocity support BDS.
+  pp.query("fused_scalar_advection", m_fusedScalarAdv);
+#ifdef PELE_USE_EFIELD
+  // Ions are advected with their drift velocities: use the standard path
+  if (m_fusedScalarAdv != 0) {
+    amrex::Print() << " WARNING: fused_scalar_advection not available with "
+                      "PELE_USE_EFIELD, deactivating it\n";
+    m_fusedScalarAdv = 0;
+  }
+#endif
 
   // -----------------------------------------
   // Linear solvers tols
@@ -618,6 +787,14 @@ PeleLM::readParameters()
     ppa.query("regrid_int", m_regrid_int);
     ppa.query("regrid_on_restart", m_regrid_on_restart);
   }
+  pp.query("regrid_lookahead", m_regridLookahead);
+  pp.query("fused_tagging", m_fusedTagging);
+  pp.query("auto_max_grid_size", m_autoMaxGridSize);
+  pp.query("auto_max_grid_size_max", m_autoMaxGridSizeMax);
+  pp.query("auto_max_grid_size_overhead", m_autoMaxGridSizeOverhead);
+  std::string regridReportFile;
+  pp.query("regrid_report_file", regridReportFile);
+  m_regridReport.define(regridReportFile);
 
 #ifdef AMREX_USE_EB
   if (max_level > 0) {
@@ -630,16 +807,25 @@ PeleLM::readParameters()
     m_EB_refine_LevMax = max_level;
     pp.query("refine_EB_max_level", m_EB_refine_LevMax);
     pp.query("refine_EB_buffer", m_derefineEBBuffer);
+    pp.query("refine_EB_distance", m_EB_distance_type);
+    if (
+      m_EB_distance_type != "Interpolated" &&
+      m_EB_distance_type != "Sweeping") {
+      Abort("refine_EB_distance can only be 'Interpolated' or 'Sweeping'");
+    }
     if (m_EB_refine_type == "Adaptive") {
       m_EB_refine_LevMin = 0;
       pp.query("refine_EB_min_level", m_EB_refine_LevMin);
       m_EB_refine_LevAdapt = m_EB_refine_LevMin;
     }
-    if (m_EB_refine_LevMax < max_level) {
+    // Level 0 distance only needed when interpolated to the finer levels
+    if (
+      m_EB_refine_LevMax < max_level && m_EB_distance_type == "Interpolated") {
       m_signDistNeeded = 1;
     }
   }
   pp.query("isothermal_EB", m_isothermalEB);
+  pp.query("EB_factory_cache_size", m_EBFactoryCacheSize);
 #endif
 
   // -----------------------------------------
@@ -661,6 +847,7 @@ PeleLM::readParameters()
   // -----------------------------------------
   ppef.query("JFNK_newtonTol", m_ef_newtonTol);
   ppef.query("JFNK_maxNewton", m_ef_maxNewtonIter);
+  parseUserKey(ppef, "newton_initial_guess", newtonguess, m_ef_newtonGuess);
   ppef.query("JFNK_lambda", m_ef_lambda_jfnk);
   ppef.query("JFNK_diffType", m_ef_diffT_jfnk);
   AMREX_ASSERT(m_ef_diffT_jfnk == 1 || m_ef_diffT_jfnk == 2);
@@ -1241,6 +1428,68 @@ PeleLM::evaluateSetup()
       "transportCC", IndexType::TheCellType(), NUM_SPECIES + 2, var_names,
       the_same_box);
   }
+
+  // tabulated transport coefficients relative error
+  {
+    Vector<std::string> var_names(NUM_SPECIES + 2);
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      var_names[n] = "err_rhoD(" + spec_names[n] + ")";
+    }
+    var_names[NUM_SPECIES] = "err_Lambda";
+    var_names[NUM_SPECIES + 1] = "err_Mu";
+    evaluate_lst.add(
+      "transportTable", IndexType::TheCellType(), NUM_SPECIES + 2, var_names,
+      the_same_box);
+  }
+
+  // on-demand diffusivity relative difference
+  {
+    Vector<std::string> var_names{"err_diffusivity"};
+    evaluate_lst.add(
+      "lowMemTransport", IndexType::TheCellType(), 1, var_names, the_same_box);
+  }
+
+  // fused scalar advection terms relative difference
+  {
+    Vector<std::string> var_names(NUM_SPECIES + 2);
+    var_names[0] = "diff_A(Rho)";
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      var_names[1 + n] = "diff_A(" + spec_names[n] + ")";
+    }
+    var_names[NUM_SPECIES + 1] = "diff_A(RhoH)";
+    evaluate_lst.add(
+      "scalarAdvFused", IndexType::TheCellType(), NUM_SPECIES + 2, var_names,
+      the_same_box);
+  }
+
+  // fused species flux correction diffusion terms relative difference
+  {
+    Vector<std::string> var_names(NUM_SPECIES);
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      var_names[n] = "diff_Dhat(" + spec_names[n] + ")";
+    }
+    evaluate_lst.add(
+      "speciesFluxCorr", IndexType::TheCellType(), NUM_SPECIES, var_names,
+      the_same_box);
+  }
+
+  // multi-component species diffusion terms relative difference
+  {
+    Vector<std::string> var_names(NUM_SPECIES);
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      var_names[n] = "diff_D(" + spec_names[n] + ")";
+    }
+    evaluate_lst.add(
+      "mcDiffusion", IndexType::TheCellType(), NUM_SPECIES, var_names,
+      the_same_box);
+  }
+
+  // strip evaluation of the thermodynamics relative error
+  {
+    Vector<std::string> var_names{"err_RhoH", "err_RhoCp"};
+    evaluate_lst.add(
+      "thermoSoA", IndexType::TheCellType(), 2, var_names, the_same_box);
+  }
 }
 
 void
@@ -1373,6 +1622,15 @@ PeleLM::resizeArray()
   // Factory
   m_factory.resize(max_level + 1);
 
+  // Lagged transport references
+  m_diffRefState.resize(max_level + 1);
+  m_viscRefState.resize(max_level + 1);
+#ifdef AMREX_USE_EB
+  m_EBFactoryCache.resize(max_level + 1);
+  m_signedDistLev.resize(max_level + 1);
+  m_signedDistLevMax.resize(max_level + 1, -1.0);
+#endif
+
   // Time
   m_t_old.resize(max_level + 1);
   m_t_new.resize(max_level + 1);
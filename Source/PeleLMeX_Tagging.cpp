@@ -10,6 +10,7 @@ void
 PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
 {
   BL_PROFILE("PeleLMeX::ErrorEst()");
+  const Real t0 = m_regridReport.start();
 
 #ifdef AMREX_USE_EB
   // Tag EB up to m_EB_refine_LevMax-1 if Static or
@@ -22,12 +23,42 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
   }
 #endif
 
-  for (const auto& errTag : errTags) {
-    std::unique_ptr<MultiFab> mf;
-    if (!errTag.Field().empty()) {
-      mf = deriveComp(errTag.Field(), time, lev, errTag.NGrow());
+  if (m_fusedTagging != 0) {
+    // Derive the fields of all the criteria at once
+    Vector<std::string> tagFields;
+    int nGrowTag = 0;
+    for (const auto& errTag : errTags) {
+      if (
+        !errTag.Field().empty() &&
+        std::find(tagFields.begin(), tagFields.end(), errTag.Field()) ==
+          tagFields.end()) {
+        tagFields.push_back(errTag.Field());
+      }
+      nGrowTag = std::max(nGrowTag, errTag.NGrow());
+    }
+    std::unique_ptr<MultiFab> tagmf;
+    if (!tagFields.empty()) {
+      tagmf = deriveComps(tagFields, time, lev, nGrowTag);
+    }
+    for (const auto& errTag : errTags) {
+      if (errTag.Field().empty()) {
+        errTag(tags, nullptr, TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
+        continue;
+      }
+      const auto comp = static_cast<int>(
+        std::find(tagFields.begin(), tagFields.end(), errTag.Field()) -
+        tagFields.begin());
+      MultiFab mf(*tagmf, amrex::make_alias, comp, 1);
+      errTag(tags, &mf, TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
+    }
+  } else {
+    for (const auto& errTag : errTags) {
+      std::unique_ptr<MultiFab> mf;
+      if (!errTag.Field().empty()) {
+        mf = deriveComp(errTag.Field(), time, lev, errTag.NGrow());
+      }
+      errTag(tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
     }
-    errTag(tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
   }
 
 #ifdef AMREX_USE_EB
@@ -48,10 +79,6 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
 
   // Untag cell close to EB
   if (m_EB_refine_type == "Static" && lev >= m_EB_refine_LevMax) {
-    // Get distance function at current level
-    MultiFab signDist(grids[lev], dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
-    getEBDistance(lev, signDist);
-
     // Estimate how far I need to derefine
     Real diagFac = std::sqrt(2.0) * m_derefineEBBuffer;
     Real clearTagDist = Geom(m_EB_refine_LevMax).CellSize(0) *
@@ -62,6 +89,14 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
                       Geom(m_EB_refine_LevMax).CellSize(0) * diagFac;
     }
 
+    // Get distance function at current level
+    MultiFab signDist(grids[lev], dmap[lev], 1, 0, MFInfo(), EBFactory(lev));
+    if (m_EB_distance_type == "Sweeping") {
+      getEBDistanceSweep(lev, clearTagDist, signDist);
+    } else {
+      getEBDistance(lev, signDist);
+    }
+
     // Untag cells too close to EB
 #ifdef AMREX_USE_OMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
@@ -78,4 +113,6 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
     }
   }
 #endif
+
+  m_regridReport.stop(RegridReport::ErrorEst, t0);
 }
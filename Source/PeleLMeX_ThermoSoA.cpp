@@ -0,0 +1,283 @@
+#include <PeleLMeX_ThermoSoA.H>
+#include <PelePhysics.H>
+#include <AMReX_Array.H>
+#include <AMReX_BLProfiler.H>
+#include <AMReX_Math.H>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace amrex;
+
+namespace {
+// Temperature scaling of the polynomials, for conditioning
+constexpr Real Tref = 1000.0;
+constexpr Real tScale = 1.0 / Tref;
+constexpr int NFit = 5;
+
+// Species cp and h from the EOS, MKS units
+void
+eosCpH(Real a_T, Real* a_cp, Real* a_h)
+{
+  auto eos = pele::physics::PhysicsType::eos();
+  eos.T2Cpi(a_T, a_cp);
+  eos.T2Hi(a_T, a_h);
+  for (int n = 0; n < NUM_SPECIES; n++) {
+    a_cp[n] *= 1.0e-4; // CGS -> MKS conversion
+    a_h[n] *= 1.0e-4;  // CGS -> MKS conversion
+  }
+}
+
+// Horner evaluation of a polynomial in the scaled temperature
+Real
+evalPoly(const Real* a_c, Real a_t)
+{
+  Real val = a_c[ThermoSoA::NCoeffs - 1];
+  for (int p = ThermoSoA::NCoeffs - 2; p >= 0; --p) {
+    val = val * a_t + a_c[p];
+  }
+  return val;
+}
+
+// Fit the cp polynomial of species a_n on Chebyshev nodes of [a_Tlo, a_Thi]
+// and set the enthalpy constant at the mid-interval
+void
+fitRange(int a_n, Real a_Tlo, Real a_Thi, Real* a_hc, Real* a_cc)
+{
+  Array<Array<Real, NFit>, NFit> A;
+  Array<Real, NFit> b;
+  Real cp[NUM_SPECIES] = {0.0};
+  Real h[NUM_SPECIES] = {0.0};
+  const Real pi = amrex::Math::pi<Real>();
+  for (int m = 0; m < NFit; ++m) {
+    const Real T = 0.5 * (a_Tlo + a_Thi) -
+                   0.5 * (a_Thi - a_Tlo) * std::cos(pi * (m + 0.5) / NFit);
+    eosCpH(T, cp, h);
+    Real tp = 1.0;
+    for (int p = 0; p < NFit; ++p) {
+      A[m][p] = tp;
+      tp *= T * tScale;
+    }
+    b[m] = cp[a_n];
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (int c = 0; c < NFit; ++c) {
+    int piv = c;
+    for (int m = c + 1; m < NFit; ++m) {
+      if (std::abs(A[m][c]) > std::abs(A[piv][c])) {
+        piv = m;
+      }
+    }
+    std::swap(A[c], A[piv]);
+    std::swap(b[c], b[piv]);
+    for (int m = c + 1; m < NFit; ++m) {
+      const Real f = A[m][c] / A[c][c];
+      for (int p = c; p < NFit; ++p) {
+        A[m][p] -= f * A[c][p];
+      }
+      b[m] -= f * b[c];
+    }
+  }
+  for (int c = NFit - 1; c >= 0; --c) {
+    for (int p = c + 1; p < NFit; ++p) {
+      b[c] -= A[c][p] * b[p];
+    }
+    b[c] /= A[c][c];
+  }
+
+  // cp = sum_p b_p t^p, h = h0 + Tref * sum_p b_p t^(p+1) / (p+1)
+  for (int p = 0; p < NFit; ++p) {
+    a_cc[p] = b[p];
+    a_hc[p + 1] = Tref * b[p] / static_cast<Real>(p + 1);
+  }
+  a_cc[NFit] = 0.0;
+  a_hc[0] = 0.0;
+  const Real Tm = 0.5 * (a_Tlo + a_Thi);
+  eosCpH(Tm, cp, h);
+  a_hc[0] = h[a_n] - evalPoly(a_hc, Tm * tScale);
+}
+
+// Relative error of the species a_n polynomials, given EOS values
+Real
+fitError(
+  Real a_T, Real a_cpEos, Real a_hEos, const Real* a_hc, const Real* a_cc)
+{
+  const Real t = a_T * tScale;
+  const Real errCp = std::abs(evalPoly(a_cc, t) - a_cpEos) / std::abs(a_cpEos);
+  const Real errH = std::abs(evalPoly(a_hc, t) - a_hEos) /
+                    (std::abs(a_hEos) + std::abs(a_cpEos) * a_T);
+  return std::max(errCp, errH);
+}
+
+// Mixture sum of rhoY_k times the species polynomials on strips of cells
+void
+stripMixtureSum(
+  const Box& bx,
+  Array4<const Real> const& rhoY,
+  Array4<const Real> const& T,
+  Array4<Real> const& out,
+  const Real* a_tmid,
+  const Real* a_cLo,
+  const Real* a_cHi)
+{
+  constexpr int W = ThermoSoA::StripWidth;
+  constexpr int NC = ThermoSoA::NCoeffs;
+  const auto lo = amrex::lbound(bx);
+  const auto hi = amrex::ubound(bx);
+  Real t[W];
+  Real sum[W];
+  for (int k = lo.z; k <= hi.z; ++k) {
+    for (int j = lo.y; j <= hi.y; ++j) {
+      for (int i0 = lo.x; i0 <= hi.x; i0 += W) {
+        const int nl = std::min(W, hi.x - i0 + 1);
+        const Real* T_p = T.ptr(i0, j, k);
+        for (int l = 0; l < nl; ++l) {
+          t[l] = T_p[l] * tScale;
+          sum[l] = 0.0;
+        }
+        for (int n = 0; n < NUM_SPECIES; n++) {
+          const Real* rhoY_p = rhoY.ptr(i0, j, k, n);
+          const Real tm = a_tmid[n];
+          const Real* c_lo = a_cLo + n * NC;
+          const Real* c_hi = a_cHi + n * NC;
+          // Both ranges are evaluated and the result picked with an exact
+          // 0/1 weight: a comparison in the lane loop prevents compilers
+          // from vectorizing it unless trapping math is disabled
+          AMREX_PRAGMA_SIMD
+          for (int l = 0; l < nl; ++l) {
+            const Real tl = t[l];
+            Real v_lo = c_lo[NC - 1];
+            Real v_hi = c_hi[NC - 1];
+            for (int p = NC - 2; p >= 0; --p) {
+              v_lo = v_lo * tl + c_lo[p];
+              v_hi = v_hi * tl + c_hi[p];
+            }
+            const Real w_lo = 0.5 + std::copysign(0.5, tm - tl);
+            sum[l] += rhoY_p[l] * (w_lo * v_lo + (1.0 - w_lo) * v_hi);
+          }
+        }
+        Real* out_p = out.ptr(i0, j, k);
+        for (int l = 0; l < nl; ++l) {
+          out_p[l] = sum[l];
+        }
+      }
+    }
+  }
+}
+} // namespace
+
+bool
+ThermoSoA::define(Real a_Tmin, Real a_Tmax, Real a_tol)
+{
+  BL_PROFILE("ThermoSoA::define()");
+
+  AMREX_ALWAYS_ASSERT(a_Tmax > a_Tmin + 1000.0);
+  m_defined = false;
+  m_tmid.assign(NUM_SPECIES, a_Tmax * tScale);
+  m_hLo.assign(NUM_SPECIES * NCoeffs, 0.0);
+  m_hHi.assign(NUM_SPECIES * NCoeffs, 0.0);
+  m_cpLo.assign(NUM_SPECIES * NCoeffs, 0.0);
+  m_cpHi.assign(NUM_SPECIES * NCoeffs, 0.0);
+
+  // Low range fit on the lower end of the temperature interval
+  const Real Tfit = a_Tmin + 400.0;
+  for (int n = 0; n < NUM_SPECIES; n++) {
+    fitRange(
+      n, a_Tmin, Tfit, m_hLo.data() + n * NCoeffs, m_cpLo.data() + n * NCoeffs);
+  }
+
+  // Locate the species mid-range temperatures: scan for the first
+  // temperature where the low range fit departs from the EOS and bisect
+  Vector<Real> Tmid(NUM_SPECIES, a_Tmax);
+  Vector<int> found(NUM_SPECIES, 0);
+  Real cp[NUM_SPECIES] = {0.0};
+  Real h[NUM_SPECIES] = {0.0};
+  for (Real T = Tfit; T <= a_Tmax; T += 1.0) {
+    eosCpH(T, cp, h);
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      if (found[n] != 0) {
+        continue;
+      }
+      const Real* hc = m_hLo.data() + n * NCoeffs;
+      const Real* cc = m_cpLo.data() + n * NCoeffs;
+      if (fitError(T, cp[n], h[n], hc, cc) > a_tol) {
+        Real Tl = T - 1.0;
+        Real Th = T;
+        for (int it = 0; it < 60; ++it) {
+          const Real Tm = 0.5 * (Tl + Th);
+          Real cpm[NUM_SPECIES] = {0.0};
+          Real hm[NUM_SPECIES] = {0.0};
+          eosCpH(Tm, cpm, hm);
+          if (fitError(Tm, cpm[n], hm[n], hc, cc) > a_tol) {
+            Th = Tm;
+          } else {
+            Tl = Tm;
+          }
+        }
+        Tmid[n] = Th;
+        found[n] = 1;
+      }
+    }
+  }
+
+  // Refit both ranges on their full extent, a single range if no
+  // mid-range temperature was found
+  constexpr Real minRange = 100.0;
+  for (int n = 0; n < NUM_SPECIES; n++) {
+    Real* hLo = m_hLo.data() + n * NCoeffs;
+    Real* cpLo = m_cpLo.data() + n * NCoeffs;
+    Real* hHi = m_hHi.data() + n * NCoeffs;
+    Real* cpHi = m_cpHi.data() + n * NCoeffs;
+    if (found[n] == 0) {
+      fitRange(n, a_Tmin, a_Tmax, hLo, cpLo);
+      std::copy(hLo, hLo + NCoeffs, hHi);
+      std::copy(cpLo, cpLo + NCoeffs, cpHi);
+      continue;
+    }
+    if (Tmid[n] - a_Tmin < minRange || a_Tmax - Tmid[n] < minRange) {
+      m_maxError = 1.0;
+      return false;
+    }
+    fitRange(n, a_Tmin, Tmid[n], hLo, cpLo);
+    fitRange(n, Tmid[n], a_Tmax, hHi, cpHi);
+    m_tmid[n] = Tmid[n] * tScale;
+  }
+
+  // Check the polynomials against the EOS
+  m_maxError = 0.0;
+  for (Real T = a_Tmin; T <= a_Tmax; T += 0.5) {
+    eosCpH(T, cp, h);
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      const bool low = T * tScale < m_tmid[n];
+      const Real* hc = (low ? m_hLo.data() : m_hHi.data()) + n * NCoeffs;
+      const Real* cc = (low ? m_cpLo.data() : m_cpHi.data()) + n * NCoeffs;
+      m_maxError = std::max(m_maxError, fitError(T, cp[n], h[n], hc, cc));
+    }
+  }
+  m_defined = (m_maxError <= a_tol);
+  return m_defined;
+}
+
+void
+ThermoSoA::getRHmix(
+  const Box& bx,
+  Array4<const Real> const& rhoY,
+  Array4<const Real> const& T,
+  Array4<Real> const& rhoH) const
+{
+  AMREX_ASSERT(m_defined);
+  stripMixtureSum(bx, rhoY, T, rhoH, m_tmid.data(), m_hLo.data(), m_hHi.data());
+}
+
+void
+ThermoSoA::getRhoCpmix(
+  const Box& bx,
+  Array4<const Real> const& rhoY,
+  Array4<const Real> const& T,
+  Array4<Real> const& rhoCp) const
+{
+  AMREX_ASSERT(m_defined);
+  stripMixtureSum(
+    bx, rhoY, T, rhoCp, m_tmid.data(), m_cpLo.data(), m_cpHi.data());
+}
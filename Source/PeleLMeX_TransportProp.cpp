@@ -5,6 +5,8 @@
 #ifdef PELE_USE_EFIELD
 #include <PeleLMeX_EF_K.H>
 #endif
+#include <AMReX_ParallelReduce.H>
+#include <numeric>
 
 using namespace amrex;
 
@@ -90,7 +92,16 @@ PeleLM::calcTurbViscosity(const TimeStamp& a_time)
     for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
       auto const& velgrad_arr = GradVel[lev][idim].const_arrays();
       auto const& dens_arr = dens_fc[idim].const_arrays();
-      auto const& mut_arr = ldata_p->visc_turb_fc[idim].arrays();
+#ifdef PELE_USE_FLOAT_AUX
+      // Evaluate the model in Real, stored in AuxReal afterward
+      MultiFab mut_fc(
+        ldata_p->visc_turb_fc[idim].boxArray(),
+        ldata_p->visc_turb_fc[idim].DistributionMap(), 1,
+        ldata_p->visc_turb_fc[idim].nGrowVect());
+#else
+      MultiFab& mut_fc = ldata_p->visc_turb_fc[idim];
+#endif
+      auto const& mut_arr = mut_fc.arrays();
       const amrex::Real vol = AMREX_D_TERM(
         geom[lev].CellSize(0), *geom[lev].CellSize(1), *geom[lev].CellSize(2));
       const amrex::Real l_scale =
@@ -104,7 +115,7 @@ PeleLM::calcTurbViscosity(const TimeStamp& a_time)
         const amrex::Real prefact =
           m_les_cs_smag * m_les_cs_smag * l_scale * l_scale;
         amrex::ParallelFor(
-          ldata_p->visc_turb_fc[idim], ldata_p->visc_turb_fc[idim].nGrowVect(),
+          mut_fc, mut_fc.nGrowVect(),
           [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
             getTurbViscSmagorinsky(
               i, j, k, prefact, Array4<Real const>(velgrad_arr[box_no]),
@@ -148,7 +159,7 @@ PeleLM::calcTurbViscosity(const TimeStamp& a_time)
         const amrex::Real prefact =
           m_les_cm_wale * m_les_cm_wale * l_scale * l_scale;
         amrex::ParallelFor(
-          ldata_p->visc_turb_fc[idim], ldata_p->visc_turb_fc[idim].nGrowVect(),
+          mut_fc, mut_fc.nGrowVect(),
           [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
             getTurbViscWALE(
               i, j, k, prefact, Array4<Real const>(velgrad_arr[box_no]),
@@ -192,7 +203,7 @@ PeleLM::calcTurbViscosity(const TimeStamp& a_time)
         const amrex::Real prefact =
           m_les_cs_sigma * m_les_cs_sigma * l_scale * l_scale;
         amrex::ParallelFor(
-          ldata_p->visc_turb_fc[idim], ldata_p->visc_turb_fc[idim].nGrowVect(),
+          mut_fc, mut_fc.nGrowVect(),
           [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
             getTurbViscSigma(
               i, j, k, prefact, Array4<Real const>(velgrad_arr[box_no]),
@@ -237,13 +248,21 @@ PeleLM::calcTurbViscosity(const TimeStamp& a_time)
 
       // Compute lambda_turb = alpha_t * cp = mu_t / Pr_t * cp
       if (m_incompressible == 0) {
-        amrex::MultiFab::Copy(
-          ldata_p->lambda_turb_fc[idim], ldata_p->visc_turb_fc[idim], 0, 0, 1,
-          0);
-        amrex::MultiFab::Multiply(
-          ldata_p->lambda_turb_fc[idim], cp_fc[idim], 0, 0, 1, 0);
-        ldata_p->lambda_turb_fc[idim].mult(m_Prandtl_inv);
+        auto const& cp_arr = cp_fc[idim].const_arrays();
+        auto const& lamt_arr = ldata_p->lambda_turb_fc[idim].arrays();
+        const amrex::Real Pr_inv = m_Prandtl_inv;
+        amrex::ParallelFor(
+          ldata_p->lambda_turb_fc[idim],
+          [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+            lamt_arr[box_no](i, j, k) = static_cast<AuxReal>(
+              mut_arr[box_no](i, j, k) * cp_arr[box_no](i, j, k) * Pr_inv);
+          });
+        Gpu::streamSynchronize();
       }
+#ifdef PELE_USE_FLOAT_AUX
+      amrex::Copy(
+        ldata_p->visc_turb_fc[idim], mut_fc, 0, 0, 1, mut_fc.nGrowVect());
+#endif
     }
   }
 }
@@ -253,6 +272,11 @@ PeleLM::calcViscosity(const TimeStamp& a_time)
 {
   BL_PROFILE("PeleLMeX::calcViscosity()");
 
+  // Lagged transport: flags of the boxes recomputed, kept alive until sync
+  Vector<Gpu::DeviceVector<int>> flags(finest_level + 1);
+  bool lagged = false;
+  Long nFlagged = 0;
+  Long nBoxes = 0;
   for (int lev = 0; lev <= finest_level; ++lev) {
 
     auto* ldata_p = getLevelDataPtr(lev, a_time);
@@ -268,17 +292,52 @@ PeleLM::calcViscosity(const TimeStamp& a_time)
       auto const& sma = ldata_p->state.const_arrays();
       auto const& vma = ldata_p->visc_cc.arrays();
 
+      // Lagged transport: only recompute the boxes where T or Y changed
+      const int* flags_p = nullptr;
+      MultiArray4<Real> rma;
+      if (useLaggedTransport(lev, a_time, m_viscRefState)) {
+        lagged = true;
+        nFlagged += flagLaggedTransportBoxes(
+          ldata_p->state, *m_viscRefState[lev], flags[lev]);
+        nBoxes += ldata_p->visc_cc.local_size();
+        flags_p = flags[lev].data();
+        rma = m_viscRefState[lev]->arrays();
+      }
+
+      // Tabulated transport fast path
+      const bool use_table = useTransportTable();
+      const TransportTableData tab = m_transportTable.data();
+
       amrex::ParallelFor(
         ldata_p->visc_cc, ldata_p->visc_cc.nGrowVect(),
         [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
-          getVelViscosity(
-            i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
-            Array4<Real>(sma[box_no], TEMP), Array4<Real>(vma[box_no], 0),
-            ltransparm);
+          if (flags_p != nullptr) {
+            if (flags_p[box_no] == 0) {
+              return;
+            }
+            setTransportRefState(
+              i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+              Array4<Real const>(sma[box_no], TEMP), rma[box_no]);
+          }
+          if (use_table) {
+            getVelViscosityTable(
+              i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+              Array4<Real const>(sma[box_no], TEMP),
+              Array4<Real>(vma[box_no], 0), tab);
+          } else {
+            getVelViscosity(
+              i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+              Array4<Real>(sma[box_no], TEMP), Array4<Real>(vma[box_no], 0),
+              ltransparm);
+          }
         });
     }
   }
   Gpu::streamSynchronize();
+
+  if (lagged) {
+    reportLaggedTransport("viscosity", nFlagged, nBoxes);
+  }
 }
 
 void
@@ -286,6 +345,11 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
 {
   BL_PROFILE("PeleLMeX::calcDiffusivity()");
 
+  // Lagged transport: flags of the boxes recomputed, kept alive until sync
+  Vector<Gpu::DeviceVector<int>> flags(finest_level + 1);
+  bool lagged = false;
+  Long nFlagged = 0;
+  Long nBoxes = 0;
   for (int lev = 0; lev <= finest_level; ++lev) {
 
     auto* ldata_p = getLevelDataPtr(lev, a_time);
@@ -313,16 +377,49 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
     const int soret_idx =
       do_soret ? 1
                : 0; // pass soret array, or pass mu as dummy (won't do anything)
+
+    // Lagged transport: only recompute the boxes where T or Y changed
+    const int* flags_p = nullptr;
+    MultiArray4<Real> rma;
+    if (useLaggedTransport(lev, a_time, m_diffRefState)) {
+      lagged = true;
+      nFlagged += flagLaggedTransportBoxes(
+        ldata_p->state, *m_diffRefState[lev], flags[lev]);
+      nBoxes += ldata_p->diff_cc.local_size();
+      flags_p = flags[lev].data();
+      rma = m_diffRefState[lev]->arrays();
+    }
+
+    // Tabulated transport fast path
+    const bool use_table = useTransportTable();
+    const TransportTableData tab = m_transportTable.data();
+
     amrex::ParallelFor(
       ldata_p->diff_cc, ldata_p->diff_cc.nGrowVect(),
       [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
-        getTransportCoeff(
-          i, j, k, do_fixed_Le, do_fixed_Pr, do_soret, Le_inv, Pr_inv,
-          Array4<Real const>(sma[box_no], FIRSTSPEC),
-          Array4<Real const>(sma[box_no], TEMP), Array4<Real>(dma[box_no], 0),
-          Array4<Real>(dma[box_no], NUM_SPECIES + 1 + soret_idx),
-          Array4<Real>(dma[box_no], NUM_SPECIES),
-          Array4<Real>(dma[box_no], NUM_SPECIES + 1), ltransparm);
+        if (flags_p != nullptr) {
+          if (flags_p[box_no] == 0) {
+            return;
+          }
+          setTransportRefState(
+            i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+            Array4<Real const>(sma[box_no], TEMP), rma[box_no]);
+        }
+        if (use_table) {
+          getTransportCoeffTable(
+            i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+            Array4<Real const>(sma[box_no], TEMP), Array4<Real>(dma[box_no], 0),
+            Array4<Real>(dma[box_no], NUM_SPECIES),
+            Array4<Real>(dma[box_no], NUM_SPECIES + 1), tab);
+        } else {
+          getTransportCoeff(
+            i, j, k, do_fixed_Le, do_fixed_Pr, do_soret, Le_inv, Pr_inv,
+            Array4<Real const>(sma[box_no], FIRSTSPEC),
+            Array4<Real const>(sma[box_no], TEMP), Array4<Real>(dma[box_no], 0),
+            Array4<Real>(dma[box_no], NUM_SPECIES + 1 + soret_idx),
+            Array4<Real>(dma[box_no], NUM_SPECIES),
+            Array4<Real>(dma[box_no], NUM_SPECIES + 1), ltransparm);
+        }
 #ifdef PELE_USE_EFIELD
         getKappaSp(
           i, j, k, mwt.arr, zk, Array4<Real const>(sma[box_no], FIRSTSPEC),
@@ -332,6 +429,150 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
       });
   }
   Gpu::streamSynchronize();
+
+  if (lagged) {
+    reportLaggedTransport("diffusivity", nFlagged, nBoxes);
+  }
+
+  if (m_lowMemTransport != 0) {
+    m_sharedDiffHolds = (a_time == AmrOldTime) ? 1 : 2;
+  }
+}
+
+void
+PeleLM::resetLaggedTransport()
+{
+  if (m_laggedTransportTol <= 0.0 || m_incompressible != 0) {
+    return;
+  }
+
+  BL_PROFILE("PeleLMeX::resetLaggedTransport()");
+
+  // The new time coefficients are copied from the old ones: use the old state
+  // as reference
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto* ldata_p = getLevelDataPtr(lev, AmrOldTime);
+    for (auto* refs : {&m_diffRefState, &m_viscRefState}) {
+      auto& ref = (*refs)[lev];
+      if (
+        !ref || ref->boxArray() != grids[lev] ||
+        ref->DistributionMap() != dmap[lev]) {
+        ref = std::make_unique<MultiFab>(
+          grids[lev], dmap[lev], NUM_SPECIES + 1, 1, MFInfo(), Factory(lev));
+      }
+      auto const& sma = ldata_p->state.const_arrays();
+      auto const& rma = ref->arrays();
+      amrex::ParallelFor(
+        *ref, ref->nGrowVect(),
+        [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+          setTransportRefState(
+            i, j, k, Array4<Real const>(sma[box_no], FIRSTSPEC),
+            Array4<Real const>(sma[box_no], TEMP), rma[box_no]);
+        });
+    }
+  }
+  Gpu::streamSynchronize();
+}
+
+bool
+PeleLM::useLaggedTransport(
+  int lev,
+  const TimeStamp& a_time,
+  const Vector<std::unique_ptr<MultiFab>>& a_ref) const
+{
+  // Only the new time coefficients are lagged, and only once the reference
+  // matches the level layout
+  return m_laggedTransportTol > 0.0 && a_time == AmrNewTime &&
+         lev < a_ref.size() && a_ref[lev] &&
+         a_ref[lev]->boxArray() == grids[lev] &&
+         a_ref[lev]->DistributionMap() == dmap[lev];
+}
+
+int
+PeleLM::flagLaggedTransportBoxes(
+  const MultiFab& a_state,
+  const MultiFab& a_ref,
+  Gpu::DeviceVector<int>& a_flags)
+{
+  BL_PROFILE("PeleLMeX::flagLaggedTransportBoxes()");
+
+  const Real tol = m_laggedTransportTol;
+  Gpu::DeviceVector<int> flags_d(a_ref.local_size(), 0);
+  int* flags = flags_d.data();
+
+  // One flag per box, ghost cells included. No tiling: each box is flagged
+  // by a single thread
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(a_ref, false); mfi.isValid(); ++mfi) {
+    const Box& gbx = mfi.fabbox();
+    auto const& rhoY = a_state.const_array(mfi, FIRSTSPEC);
+    auto const& T = a_state.const_array(mfi, TEMP);
+    auto const& ref = a_ref.const_array(mfi);
+    int* boxFlag = flags + mfi.LocalIndex();
+    ParallelFor(gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      // Also catches NaNs in the state
+      if (!(getTransportRefChange(i, j, k, rhoY, T, ref) <= tol)) {
+        Gpu::Atomic::Max(boxFlag, 1);
+      }
+    });
+  }
+
+  Vector<int> flags_h(flags_d.size());
+  Gpu::copy(Gpu::deviceToHost, flags_d.begin(), flags_d.end(), flags_h.begin());
+  const int nFlagged = std::accumulate(flags_h.begin(), flags_h.end(), 0);
+  a_flags = std::move(flags_d);
+  return nFlagged;
+}
+
+void
+PeleLM::reportLaggedTransport(
+  const std::string& a_name, Long a_nFlagged, Long a_nBoxes)
+{
+  if (m_verbose > 1) {
+    Long counts[2] = {a_nFlagged, a_nBoxes};
+    ParallelAllReduce::Sum(counts, 2, ParallelContext::CommunicatorSub());
+    Print() << "   Lagged transport: recomputed " << a_name << " in "
+            << counts[0] << " / " << counts[1] << " boxes ("
+            << 100.0 * static_cast<Real>(counts[0]) /
+                 static_cast<Real>(counts[1])
+            << "%)\n";
+  }
+}
+
+void
+PeleLM::ensureDiffusivity(const TimeStamp& a_time)
+{
+  if (m_lowMemTransport == 0 || m_incompressible != 0) {
+    return;
+  }
+
+  AMREX_ASSERT(a_time == AmrOldTime || a_time == AmrNewTime);
+  const bool holdsOld = (m_sharedDiffHolds == 1 || m_sharedDiffHolds == 3);
+  const bool holdsNew = (m_sharedDiffHolds == 2 || m_sharedDiffHolds == 3);
+  if (
+    (a_time == AmrOldTime && !holdsOld) ||
+    (a_time == AmrNewTime && !holdsNew)) {
+    if (m_verbose > 2) {
+      Print() << "   Recomputing shared diffusivity for "
+              << ((a_time == AmrOldTime) ? "Old" : "New") << " time\n";
+    }
+    calcDiffusivity(a_time);
+  }
+}
+
+void
+PeleLM::shareDiffusivity(int lev)
+{
+  if (m_lowMemTransport == 0 || m_incompressible != 0) {
+    return;
+  }
+
+  auto& diff_new = m_leveldata_new[lev]->diff_cc;
+  m_leveldata_old[lev]->diff_cc =
+    MultiFab(diff_new, amrex::make_alias, 0, diff_new.nComp());
+  m_sharedDiffHolds = 0;
 }
 
 Array<MultiFab, AMREX_SPACEDIM>
@@ -432,26 +673,43 @@ PeleLM::getDiffusivity(
     auto* ldata_p = getLevelDataPtr(lev, tstamp);
 
     // Identify and add the correct turbulent contribution
+    // Turbulent coefficients are stored as AuxReal: convert at use
     for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+      auto const& beta_arr = beta_ec[idim].arrays();
       if ((ncomp == 1) and (beta_comp == 0)) { // Viscosity
-        amrex::MultiFab::Add(
-          beta_ec[idim], ldata_p->visc_turb_fc[idim], 0, 0, 1, 0);
+        auto const& mut_arr = ldata_p->visc_turb_fc[idim].const_arrays();
+        amrex::ParallelFor(
+          beta_ec[idim],
+          [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+            beta_arr[box_no](i, j, k) +=
+              static_cast<amrex::Real>(mut_arr[box_no](i, j, k));
+          });
       } else if ((ncomp == NUM_SPECIES) and (beta_comp == 0)) { // Species
                                                                 // diffusivity
-        for (int ispec = 0; ispec < NUM_SPECIES; ispec++) {
-          amrex::MultiFab::Saxpy(
-            beta_ec[idim], m_Schmidt_inv, ldata_p->visc_turb_fc[idim], 0, ispec,
-            1, 0);
-        }
+        auto const& mut_arr = ldata_p->visc_turb_fc[idim].const_arrays();
+        const amrex::Real Sc_inv = m_Schmidt_inv;
+        amrex::ParallelFor(
+          beta_ec[idim], NUM_SPECIES,
+          [=] AMREX_GPU_DEVICE(
+            int box_no, int i, int j, int k, int n) noexcept {
+            beta_arr[box_no](i, j, k, n) +=
+              Sc_inv * static_cast<amrex::Real>(mut_arr[box_no](i, j, k));
+          });
       } else if ((ncomp == 1) and (beta_comp == NUM_SPECIES)) { // Thermal
                                                                 // conductivity
-        amrex::MultiFab::Add(
-          beta_ec[idim], ldata_p->lambda_turb_fc[idim], 0, 0, 1, 0);
+        auto const& lamt_arr = ldata_p->lambda_turb_fc[idim].const_arrays();
+        amrex::ParallelFor(
+          beta_ec[idim],
+          [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+            beta_arr[box_no](i, j, k) +=
+              static_cast<amrex::Real>(lamt_arr[box_no](i, j, k));
+          });
       } else { // Invalid
         amrex::Abort("getDiffusivity(): LES model is on but cannot provide a "
                      "turbulent transport coefficient");
       }
     }
+    Gpu::streamSynchronize();
   }
 
   // Enable zeroing diffusivity on faces to produce walls
@@ -0,0 +1,83 @@
+#include <PeleLMeX_TransportTable.H>
+#include <cmath>
+
+using namespace amrex;
+
+void
+TransportTable::define(
+  Real a_Tmin,
+  Real a_Tmax,
+  Real a_dT,
+  pele::physics::transport::TransParm<
+    pele::physics::PhysicsType::eos_type,
+    pele::physics::PhysicsType::transport_type> const* a_transparm)
+{
+  BL_PROFILE("TransportTable::define()");
+
+  AMREX_ALWAYS_ASSERT(a_Tmax > a_Tmin && a_dT > 0.0);
+  const int nT = static_cast<int>(std::ceil((a_Tmax - a_Tmin) / a_dT)) + 1;
+  m_mu.resize(static_cast<std::size_t>(nT) * NUM_SPECIES);
+  m_lambda.resize(static_cast<std::size_t>(nT) * NUM_SPECIES);
+  m_bdiffinv.resize(static_cast<std::size_t>(nT) * NUM_SPECIES * NUM_SPECIES);
+
+  // Evaluate the full transport model for each pure species: the mixture
+  // averaged diffusion coefficient of species k in pure species j reduces to
+  // the binary coefficient D_kj
+  Real* mu_p = m_mu.data();
+  Real* lam_p = m_lambda.data();
+  Real* bd_p = m_bdiffinv.data();
+  const Real Tmin = a_Tmin;
+  const Real dT = a_dT;
+  amrex::ParallelFor(nT * NUM_SPECIES, [=] AMREX_GPU_DEVICE(int idx) noexcept {
+    const int it = idx / NUM_SPECIES;
+    const int jsp = idx % NUM_SPECIES;
+    Real Tloc = Tmin + static_cast<Real>(it) * dT;
+    Real y[NUM_SPECIES] = {0.0};
+    y[jsp] = 1.0;
+
+    auto eos = pele::physics::PhysicsType::eos();
+    Real mwt[NUM_SPECIES] = {0.0};
+    eos.molecular_weight(mwt);
+    Real P_cgs = 1013250.0; // The coefficients rho*D do not depend on P
+    Real rho_cgs = 0.0;
+    eos.PYT2R(P_cgs, y, Tloc, rho_cgs);
+
+    Real rhoDi_cgs[NUM_SPECIES] = {0.0};
+    Real chi_loc[NUM_SPECIES] = {0.0};
+    Real mu_cgs = 0.0;
+    Real lambda_cgs = 0.0;
+    Real dummy_xi = 0.0;
+    bool get_xi = false;
+    bool get_mu = true;
+    bool get_lam = true;
+    bool get_Ddiag = true;
+    bool get_chi = false;
+    auto trans = pele::physics::PhysicsType::transport();
+    trans.transport(
+      get_xi, get_mu, get_lam, get_Ddiag, get_chi, Tloc, rho_cgs, y, rhoDi_cgs,
+      chi_loc, mu_cgs, dummy_xi, lambda_cgs, a_transparm);
+
+    // Do CGS -> MKS conversions, rho_j D_kj / W_j is stored inverted
+    mu_p[idx] = mu_cgs * 1.0e-1;
+    lam_p[idx] = lambda_cgs * 1.0e-5;
+    Real* bd_j = bd_p + static_cast<std::size_t>(idx) * NUM_SPECIES;
+    for (int n = 0; n < NUM_SPECIES; n++) {
+      bd_j[n] = (n == jsp) ? 0.0 : 1.0e1 * mwt[jsp] / rhoDi_cgs[n];
+    }
+  });
+  Gpu::streamSynchronize();
+
+  m_data.nT = nT;
+  m_data.Tmin = a_Tmin;
+  m_data.dTinv = 1.0 / a_dT;
+  m_data.mu = m_mu.data();
+  m_data.lambda = m_lambda.data();
+  m_data.bdiffinv = m_bdiffinv.data();
+}
+
+Long
+TransportTable::nBytes() const
+{
+  return static_cast<Long>(
+    (m_mu.size() + m_lambda.size() + m_bdiffinv.size()) * sizeof(Real));
+}
@@ -754,6 +754,7 @@ PeleLM::resetCoveredMask()
       }
       m_baChem[lev] = std::make_unique<BoxArray>(std::move(bl));
       m_dmapChem[lev] = std::make_unique<DistributionMapping>(*m_baChem[lev]);
+      m_costMeasure.resetChemLevel(lev, *m_baChem[lev]);
 
       // Load balancing of the chemistry DMap
       if (m_doLoadBalance != 0) {
@@ -771,8 +772,9 @@ PeleLM::resetCoveredMask()
       m_baChemFlag[finest_level].begin(), m_baChemFlag[finest_level].end(), 1);
     m_dmapChem[finest_level] =
       std::make_unique<DistributionMapping>(*m_baChem[finest_level]);
+    m_costMeasure.resetChemLevel(finest_level, *m_baChem[finest_level]);
 
-    if ((m_doLoadBalance != 0) && m_max_grid_size_chem.min() > 0) {
+    if ((m_doLoadBalance != 0) && useChemLayout(finest_level)) {
       loadBalanceChemLev(finest_level);
     }
 
@@ -805,7 +807,7 @@ PeleLM::loadBalanceChem()
   for (int lev = 0; lev <= finest_level; ++lev) {
     // Finest grid uses AmrCore DM unless different max grid size specified.
     // Keep the AmrCore DM.
-    if (lev == finest_level && m_max_grid_size_chem.min() < 0) {
+    if (!useChemLayout(lev)) {
       continue;
     }
     loadBalanceChemLev(lev);
@@ -1015,6 +1017,111 @@ PeleLM::deriveComp(const std::string& a_name, Real a_time, int lev, int nGrow)
   return mf;
 }
 
+// Return a unique_ptr with one component per requested variable. The state
+// and reaction data are fillpatched once and each derive record is only
+// evaluated once per tile, in tile-sized scratch FABs.
+std::unique_ptr<MultiFab>
+PeleLM::deriveComps(
+  const Vector<std::string>& a_names, Real a_time, int lev, int nGrow)
+{
+  BL_PROFILE("PeleLMeX::deriveComps()");
+  AMREX_ASSERT(nGrow >= 0);
+
+  // Source of each variable: index in recs, or state/reaction component
+  const int stateSrc = -1;
+  const int reactSrc = -2;
+  const int nvars = static_cast<int>(a_names.size());
+  Vector<const PeleLMDeriveRec*> recs;
+  Vector<int> varSrc(nvars, stateSrc);
+  Vector<int> varComp(nvars, 0);
+  bool needReact = false;
+  for (int n = 0; n < nvars; ++n) {
+    const auto& name = a_names[n];
+    bool itexists = derive_lst.canDerive(name) || isStateVariable(name) ||
+                    isReactVariable(name);
+    if (!itexists) {
+      amrex::Error("PeleLM::deriveComps(): unknown variable: " + name);
+    }
+    const PeleLMDeriveRec* rec = derive_lst.get(name);
+    if (rec != nullptr) {
+      auto it = std::find(recs.begin(), recs.end(), rec);
+      varSrc[n] = static_cast<int>(it - recs.begin());
+      if (it == recs.end()) {
+        recs.push_back(rec);
+      }
+      varComp[n] = rec->variableComp(name);
+      if (varComp[n] < 0) {
+        amrex::Error(
+          "PeleLM::deriveComps(): unknown derive component: " + name + " of " +
+          rec->variableName(1000));
+      }
+      needReact = needReact || (m_do_react != 0);
+    } else if (isStateVariable(name)) {
+      varComp[n] = stateVariableIndex(name);
+    } else {
+      varSrc[n] = reactSrc;
+      varComp[n] = reactVariableIndex(name);
+      needReact = true;
+    }
+  }
+
+  auto mf = std::make_unique<MultiFab>(
+    grids[lev], dmap[lev], nvars, nGrow, MFInfo(), Factory(lev));
+  const int nGrowState = recs.empty() ? nGrow : std::max(nGrow, m_nGrowState);
+  std::unique_ptr<MultiFab> statemf = fillPatchState(lev, a_time, nGrowState);
+  std::unique_ptr<MultiFab> reactmf;
+  if (needReact) {
+    reactmf = fillPatchReact(lev, a_time, nGrow);
+  }
+  // Get pressure: TODO no fillpatch for pressure just yet, simply get new
+  // state
+  auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+  auto stateBCs = fetchBCRecArray(VELX, NVAR);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.growntilebox(nGrow);
+    FArrayBox const& statefab = (*statemf)[mfi];
+    FArrayBox const& pressfab = ldata_p->press[mfi];
+    FArrayBox const& reactfab = reactmf ? (*reactmf)[mfi] : pressfab;
+    auto const& out = mf->array(mfi);
+
+    for (int r = 0; r < recs.size(); ++r) {
+      FArrayBox derfab(bx, recs[r]->numDerive(), The_Async_Arena());
+      recs[r]->derFunc()(
+        this, bx, derfab, 0, recs[r]->numDerive(), statefab, reactfab, pressfab,
+        geom[lev], a_time, stateBCs, lev);
+      auto const& der = derfab.const_array();
+      for (int n = 0; n < nvars; ++n) {
+        if (varSrc[n] == r) {
+          const int dcomp = varComp[n];
+          ParallelFor(
+            bx, [out, der, n,
+                 dcomp] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+              out(i, j, k, n) = der(i, j, k, dcomp);
+            });
+        }
+      }
+    }
+
+    for (int n = 0; n < nvars; ++n) {
+      if (varSrc[n] < 0) {
+        auto const& src = (varSrc[n] == stateSrc)
+                            ? statemf->const_array(mfi, varComp[n])
+                            : reactmf->const_array(mfi, varComp[n]);
+        ParallelFor(
+          bx, [out, src, n] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            out(i, j, k, n) = src(i, j, k);
+          });
+      }
+    }
+  }
+
+  return mf;
+}
+
 void
 PeleLM::initProgressVariable()
 {
@@ -1703,6 +1810,17 @@ PeleLM::checkMemory(const std::string& a_message) const
   Print() << "     [" << a_message << "] MFs mem. allocated (MB) "
           << max_fab_megabytes << "\n";
 #endif
+
+  // Temporary MultiFab pool usage
+  if (m_mfPool.isActive()) {
+    Long pool_data[3] = {
+      m_mfPool.bytesCached() / (1024 * 1024),
+      m_mfPool.bytesCachedHWM() / (1024 * 1024), m_mfPool.nAllocAvoided()};
+    ParallelDescriptor::ReduceLongMax(pool_data, 3, IOProc);
+    Print() << "     [" << a_message << "] MF pool mem. cached (MB) "
+            << pool_data[0] << ", peak " << pool_data[1]
+            << ", allocations avoided " << pool_data[2] << "\n";
+  }
 }
 
 void